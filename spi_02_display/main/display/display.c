@@ -1,165 +1,643 @@
 #include "display.h"
-#include "driver/gpio.h"
+#include "display_priv.h"
+#include "display_bus.h"
 #include "freertos/task.h"
 #include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "esp_attr.h"
+#if CONFIG_IDF_TARGET_LINUX
+#include "display_host.h"
+#else
+#include "esp_memory_utils.h"
+#endif
+#include <stdbool.h>
+#include <string.h>
 
-#define PIN_NUM_MOSI 23
-#define PIN_NUM_MISO -1
-#define PIN_NUM_CLK  19
-#define PIN_NUM_CS   5
-#define PIN_NUM_DC   2
-#define PIN_NUM_RST  4
-#define PIN_NUM_LED  15
+// Transfers kept in flight by the queued (DMA pipelined) transfer path.
+// Deep enough to hold a whole 240x320 frame in 4 KB chunks, so
+// draw_image_async() can queue a full blit and return without blocking.
+#define TRANS_POOL_SIZE DISPLAY_BUS_DEPTH
 
-spi_device_handle_t spi;
+// Everything one panel needs: its bus device, the transfers it has in
+// flight and its orientation. Allocated DMA-capable, since fill_line can
+// end up on the wire.
+struct display {
+    display_config_t cfg;
+    const display_bus_t *bus;
+    void *bus_dev;              // backend state for this panel
+
+    display_xfer_t trans_pool[TRANS_POOL_SIZE];
+    uint32_t trans_queued;      // transfers handed to the bus
+    uint32_t trans_done;        // transfers whose results were collected
+    display_stats_t stats;
+
+    bool bursting;              // bus held for a long run, see burst_begin()
+    int burst_left;             // bytes left in the current quantum
+
+    // Internal bounce buffers for pixel data the DMA can't read, allocated
+    // on first use
+    display_pingpong_t bounce;
+
+    // Solid fill pattern, see fill_pixels()
+    uint16_t *fill_buf;
+    int fill_len;               // pixels in fill_buf
+    bool fill_valid;
+    uint16_t fill_color;
+    uint32_t fill_seq;
+    WORD_ALIGNED_ATTR uint16_t fill_line[DISPLAY_PANEL_WIDTH];  // fallback if the big buffer can't be had
+
+    display_rotation_t rotation;
+    bool mirror_x, mirror_y;
+    uint8_t madctl;
+    uint16_t width, height;
+
+    display_scroll_state_t scroll;
+    display_vsync_state_t vsync;
+};
+
+// MADCTL per rotation: row/column order and exchange (MY MX MV) plus BGR,
+// as the panel's color filter is BGR. 0x48 is upright portrait.
+static const uint8_t rotation_madctl[4] = {0x48, 0x28, 0x88, 0xE8};
+
+// The panel behind the single-panel calls (display_configure(),
+// display_gpio_init(), display_spi_init())
+static display_t default_display = {
+    .cfg = DISPLAY_CONFIG_DEFAULT(),
+    .madctl = 0x48,
+    .width = DISPLAY_PANEL_WIDTH,
+    .height = DISPLAY_PANEL_HEIGHT,
+    .scroll = {.height = DISPLAY_PANEL_HEIGHT},
+    .vsync = {.refresh_hz = DISPLAY_REFRESH_HZ_DEFAULT},
+};
+
+// Per task, so a task driving one panel is not redirected by another
+static __thread display_t *selected;
+
+display_t *display_selected(void) {
+    return selected ? selected : &default_display;
+}
+
+void display_select(display_t *disp) {
+    selected = disp;
+}
+
+static const display_bus_t *bus_of(display_t *d) {
+    if (!d->bus) {
+#if CONFIG_IDF_TARGET_LINUX
+        d->bus = d->cfg.bus ? d->cfg.bus : &display_bus_host;
+#else
+        d->bus = d->cfg.bus ? d->cfg.bus : &display_bus_spi;
+#endif
+    }
+    return d->bus;
+}
+
+/* Must be called before display_gpio_init()/display_spi_init() to take effect. */
+void display_configure(const display_config_t *config) {
+    display_t *d = &default_display;
+    display_pp_free(&d->bounce);
+    d->cfg = *config;
+    d->bus = NULL;
+}
+
+const display_config_t *display_get_config(void) {
+    return &display_selected()->cfg;
+}
+
+const display_bus_t *display_bus(void) {
+    return bus_of(display_selected());
+}
+
+void *display_bus_dev(void) {
+    return display_selected()->bus_dev;
+}
+
+display_scroll_state_t *display_scroll_state(void) {
+    return &display_selected()->scroll;
+}
+
+display_vsync_state_t *display_vsync_state(void) {
+    return &display_selected()->vsync;
+}
 
 void display_gpio_init(void) {
-    gpio_set_direction(PIN_NUM_DC, GPIO_MODE_OUTPUT);
-    gpio_set_direction(PIN_NUM_RST, GPIO_MODE_OUTPUT);
-    gpio_set_direction(PIN_NUM_LED, GPIO_MODE_OUTPUT);
-    gpio_set_level(PIN_NUM_LED, 1);
-
-    gpio_set_level(PIN_NUM_RST, 0);
-    vTaskDelay(pdMS_TO_TICKS(100));
-    gpio_set_level(PIN_NUM_RST, 1);
-    vTaskDelay(pdMS_TO_TICKS(100));
-}
-
-void display_spi_init(void) {
-    spi_bus_config_t spi_config = {
-        .mosi_io_num = PIN_NUM_MOSI,
-        .miso_io_num = PIN_NUM_MISO,
-        .sclk_io_num = PIN_NUM_CLK,
-        .quadwp_io_num = -1,
-        .quadhd_io_num = -1,
-        .max_transfer_sz = 4096
-    };
+    display_t *d = display_selected();
+    bus_of(d)->reset(&d->bus_dev, &d->cfg);
+}
 
-    spi_device_interface_config_t spi_device_config = {
-        .clock_speed_hz = 10 * 1000 * 1000,
-        .mode = 0,
-        .spics_io_num = PIN_NUM_CS,
-        .queue_size = 1,
-        .flags = 0
-    };
+esp_err_t display_spi_init(void) {
+    display_t *d = display_selected();
+    return bus_of(d)->init(&d->bus_dev, &d->cfg);
+}
+
+/* A further panel: the configuration is copied, the panel's device joins
+ * the bus (the first panel on a host brings the bus up) and the panel is
+ * reset. Select it before ili9341_init() and drawing. */
+esp_err_t display_create(const display_config_t *config, display_t **out) {
+    display_t *d = heap_caps_calloc(1, sizeof(*d), MALLOC_CAP_DMA);
+    if (!d) return ESP_ERR_NO_MEM;
 
-    spi_bus_initialize(SPI2_HOST, &spi_config, SPI_DMA_CH_AUTO);
-    spi_bus_add_device(SPI2_HOST, &spi_device_config, &spi);
+    d->cfg = *config;
+    d->madctl = rotation_madctl[DISPLAY_ROTATION_0];
+    d->width = DISPLAY_PANEL_WIDTH;
+    d->height = DISPLAY_PANEL_HEIGHT;
+    d->scroll.height = DISPLAY_PANEL_HEIGHT;
+    d->vsync.refresh_hz = DISPLAY_REFRESH_HZ_DEFAULT;
+
+    esp_err_t ret = bus_of(d)->init(&d->bus_dev, &d->cfg);
+    if (ret != ESP_OK) {
+        heap_caps_free(d);
+        return ret;
+    }
+    d->bus->reset(&d->bus_dev, &d->cfg);
+    *out = d;
+    return ESP_OK;
 }
 
+/* Collect the oldest queued transfer (the bus completes them in order),
+ * freeing its pool slot. */
+static void trans_reap_one(display_t *d) {
+    int64_t t0 = esp_timer_get_time();
+    d->bus->reap(d->bus_dev);
+    d->stats.blocked_us += esp_timer_get_time() - t0;
+    d->trans_done++;
+}
+
+static void wait_done(display_t *d) {
+    while (d->trans_done != d->trans_queued) {
+        trans_reap_one(d);
+    }
+}
+
+/* Next free pool slot, waiting for the oldest transfer if all are in flight. */
+static display_xfer_t *trans_get_slot(display_t *d) {
+    while (d->trans_queued - d->trans_done >= TRANS_POOL_SIZE) {
+        trans_reap_one(d);
+    }
+    display_xfer_t *x = &d->trans_pool[d->trans_queued % TRANS_POOL_SIZE];
+    memset(x, 0, sizeof(*x));
+    return x;
+}
+
+/* Panels and the flash on one host take turns per transaction in the SPI
+ * driver, which is fair but lets a long run stall behind every other
+ * device's transfers. A run of at least burst_bytes instead holds the bus
+ * (spi_device_acquire_bus()) for burst_bytes at a time and streams without
+ * arbitration; between quanta the lock goes back, so the other panel and
+ * the flash wait at most one quantum. The lock is only handed over with
+ * this panel's transfers off the bus, so such a run returns once sent. */
+static bool burst_begin(display_t *d, uint32_t len) {
+    if (d->bursting || d->cfg.burst_bytes <= 0 || len < (uint32_t)d->cfg.burst_bytes || !d->bus->acquire) {
+        return false;
+    }
+    wait_done(d);
+    if (d->bus->acquire(d->bus_dev) != ESP_OK) return false;
+    d->bursting = true;
+    d->burst_left = d->cfg.burst_bytes;
+    return true;
+}
+
+static void burst_end(display_t *d) {
+    if (!d->bursting) return;
+    wait_done(d);
+    d->bus->release(d->bus_dev);
+    d->bursting = false;
+}
+
+static void trans_queue(display_t *d, display_xfer_t *x) {
+    if (d->bursting && d->burst_left <= 0) {
+        // x sits in a free pool slot, which reaping leaves alone
+        burst_end(d);
+        burst_begin(d, d->cfg.burst_bytes);
+    }
+    d->bus->queue(d->bus_dev, x);
+    d->trans_queued++;
+    d->burst_left -= x->len;
+    d->stats.bytes += x->len;
+    d->stats.transactions++;
+}
+
+void display_stats_get(display_stats_t *out) {
+    *out = display_selected()->stats;
+}
+
+void display_stats_reset(void) {
+    display_t *d = display_selected();
+    memset(&d->stats, 0, sizeof(d->stats));
+}
+
+uint32_t display_trans_seq(void) {
+    return display_selected()->trans_queued;
+}
+
+/* Wait until every transfer queued before display_trans_seq() returned seq
+ * has completed. */
+void display_wait_seq(uint32_t seq) {
+    display_t *d = display_selected();
+    while ((int32_t)(d->trans_done - seq) < 0) {
+        trans_reap_one(d);
+    }
+}
+
+void display_wait_done(void) {
+    wait_done(display_selected());
+}
+
+/* Queue a command byte followed by up to len parameter bytes. Parameters of
+ * four bytes or less travel inside the transaction itself. */
+static void queue_cmd(display_t *d, uint8_t cmd, const uint8_t *data, int len) {
+    display_xfer_t *x = trans_get_slot(d);
+    x->dc = 0;
+    x->len = 1;
+    x->data[0] = cmd;
+    trans_queue(d, x);
+
+    if (len == 0) return;
+    x = trans_get_slot(d);
+    x->dc = 1;
+    x->len = len;
+    if (len <= 4) {
+        memcpy(x->data, data, len);
+    } else {
+        x->tx = data;   // caller keeps it alive (command tables)
+    }
+    trans_queue(d, x);
+}
+
+/* DC travels with every transfer, so commands and data
+ * can be mixed freely in the queue. */
 void send_cmd(uint8_t cmd) {
-    gpio_set_level(PIN_NUM_DC, 0);
-    spi_transaction_t t = {
-        .length = 8,
-        .tx_buffer = &cmd,
-    };
-    spi_device_transmit(spi, &t);
+    queue_cmd(display_selected(), cmd, NULL, 0);
 }
 
+/* Short parameter blocks are copied into the transaction and return at
+ * once; longer ones wait, since data may live on the caller's stack. */
 void send_data(const uint8_t *data, int len) {
-    gpio_set_level(PIN_NUM_DC, 1);
-    spi_transaction_t t = {
-        .length = len * 8,
-        .tx_buffer = data,
-    };
-    spi_device_transmit(spi, &t);
+    display_t *d = display_selected();
+    display_xfer_t *x = trans_get_slot(d);
+    x->dc = 1;
+    x->len = len;
+    if (len <= 4) {
+        memcpy(x->data, data, len);
+        trans_queue(d, x);
+        return;
+    }
+    x->tx = data;
+    trans_queue(d, x);
+    wait_done(d);
 }
 
-void set_window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+/* Run a command table as one queued burst. The queue is only drained where
+ * an entry asks for a delay after it. */
+void display_send_cmd_list(const display_cmd_t *list) {
+    display_t *d = display_selected();
+    for (; list->len != DISPLAY_CMD_END; list++) {
+        queue_cmd(d, list->cmd, list->data, list->len);
+        if (list->delay_ms) {
+            wait_done(d);
+            vTaskDelay(pdMS_TO_TICKS(list->delay_ms));
+        }
+    }
+}
+
+static void queue_window(display_t *d, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
     uint8_t caset[] = {x0 >> 8, x0 & 0xFF, x1 >> 8, x1 & 0xFF};
     uint8_t raset[] = {y0 >> 8, y0 & 0xFF, y1 >> 8, y1 & 0xFF};
 
-    send_cmd(0x2A); send_data(caset, sizeof(caset));
-    send_cmd(0x2B); send_data(raset, sizeof(raset));
-    send_cmd(0x2C);
+    queue_cmd(d, 0x2A, caset, sizeof(caset));
+    queue_cmd(d, 0x2B, raset, sizeof(raset));
+}
+
+/* Queued: the window setup goes out back-to-back with the pixels after it. */
+void set_window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+    display_t *d = display_selected();
+    queue_window(d, x0, y0, x1, y1);
+    queue_cmd(d, 0x2C, NULL, 0);
 }
 
 void fill_color(uint16_t color) {
     clear_screen(color);
 }
 
-/* 1. New: Clear entire screen */
-void clear_screen(uint16_t color) {
-    set_window(0, 0, 239, 319);
+/* Solid fills replay one DMA-capable pattern buffer of up to max_transfer_sz
+ * bytes from queued transactions, so a fill costs one transaction per
+ * buffer length instead of one per row. The pattern is only rewritten when
+ * the color changes, after the transfers still reading it have finished. */
+static void fill_pixels(display_t *d, uint16_t color, uint32_t count) {
+    if (!d->fill_buf) {
+        d->fill_len = (d->cfg.max_transfer_sz / 2) & ~1;
+        d->fill_buf = heap_caps_malloc(d->fill_len * 2, MALLOC_CAP_DMA);
+        if (!d->fill_buf) {
+            d->fill_buf = d->fill_line;
+            d->fill_len = DISPLAY_PANEL_WIDTH;
+        }
+    }
 
-    static uint8_t line_buf[240 * 2];
-    for (int i = 0; i < 240; i++) {
-        line_buf[i * 2] = color >> 8;
-        line_buf[i * 2 + 1] = color & 0xFF;
+    if (!d->fill_valid || d->fill_color != color) {
+        display_wait_seq(d->fill_seq);
+        uint32_t pattern = DISPLAY_SWAP16(color) * 0x00010001u;
+        uint32_t *w = (uint32_t *)d->fill_buf;
+        for (int i = 0; i < d->fill_len / 2; i++) {
+            w[i] = pattern;
+        }
+        d->fill_color = color;
+        d->fill_valid = true;
     }
 
-    gpio_set_level(PIN_NUM_DC, 1);
-    for (int y = 0; y < 320; y++) {
-        spi_transaction_t t = {
-            .length = 240 * 16,
-            .tx_buffer = line_buf,
-        };
-        spi_device_transmit(spi, &t);
+    bool burst = burst_begin(d, count * 2);
+    while (count > 0) {
+        uint32_t n = (count > (uint32_t)d->fill_len) ? (uint32_t)d->fill_len : count;
+        display_xfer_t *x = trans_get_slot(d);
+        x->dc = 1;
+        x->len = n * 2;
+        x->tx = d->fill_buf;
+        trans_queue(d, x);
+        count -= n;
     }
+    if (burst) burst_end(d);
+    d->fill_seq = d->trans_queued;
+}
+
+/* 1. New: Clear entire screen */
+void clear_screen(uint16_t color) {
+    display_t *d = display_selected();
+    set_window(0, 0, d->width - 1, d->height - 1);
+    fill_pixels(d, color, d->width * d->height);
 }
 
 /* 2. New: Clear specific region */
 void clear_region(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color) {
+    display_t *d = display_selected();
+    if (x1 >= d->width) x1 = d->width - 1;
+    if (y1 >= d->height) y1 = d->height - 1;
     if (x1 < x0 || y1 < y0) return; // Safety check
 
+    // The panel wraps rows inside the window, so the fill is one flat run
     set_window(x0, y0, x1, y1);
-
-    int width = x1 - x0 + 1;
-    static uint8_t buf[480]; // up to 240 pixels per line (2 bytes each)
-    for (int i = 0; i < width; i++) {
-        buf[i * 2] = color >> 8;
-        buf[i * 2 + 1] = color & 0xFF;
-    }
-
-    gpio_set_level(PIN_NUM_DC, 1);
-    for (int y = y0; y <= y1; y++) {
-        spi_transaction_t t = {
-            .length = width * 16,
-            .tx_buffer = buf,
-        };
-        spi_device_transmit(spi, &t);
-    }
+    fill_pixels(d, color, (uint32_t)(x1 - x0 + 1) * (y1 - y0 + 1));
 }
 
 /* 3. New: Draw image from provided pixel buffer */
 void draw_image(uint16_t x0, uint16_t y0, uint16_t w, uint16_t h, const uint16_t *image_data) {
+    draw_image_async(x0, y0, w, h, image_data, NULL, NULL);
+    display_wait_done();
+}
+
+/* 4. Queue the whole image as back-to-back DMA chunks and return at once.
+ * image_data must stay valid until done_cb fires or display_wait_done(). */
+void draw_image_async(uint16_t x0, uint16_t y0, uint16_t w, uint16_t h, const uint16_t *image_data,
+                      display_done_cb_t done_cb, void *arg) {
     set_window(x0, y0, x0 + w - 1, y0 + h - 1);
 
-    gpio_set_level(PIN_NUM_DC, 1);
-    int total_pixels = w * h;
-    const uint8_t *data_ptr = (const uint8_t *)image_data;
+    display_queue_data(image_data, w * h * 2, done_cb, arg);
+}
 
-    // Transfer in chunks to avoid overflow
-    for (int offset = 0; offset < total_pixels * 2; offset += 4096) {
-        int chunk = ((total_pixels * 2 - offset) > 4096) ? 4096 : (total_pixels * 2 - offset);
-        spi_transaction_t t = {
-            .length = chunk * 8,
-            .tx_buffer = data_ptr + offset,
-        };
-        spi_device_transmit(spi, &t);
+static void queue_chunks(display_t *d, const uint8_t *data_ptr, int len, display_done_cb_t done_cb, void *arg) {
+    int max = d->cfg.max_transfer_sz;
+    for (int offset = 0; offset < len; offset += max) {
+        int chunk = ((len - offset) > max) ? max : (len - offset);
+        display_xfer_t *x = trans_get_slot(d);
+        x->dc = 1;
+        x->len = chunk;
+        x->tx = data_ptr + offset;
+        if (offset + chunk >= len) {
+            x->done_cb = done_cb;
+            x->done_arg = arg;
+        }
+        trans_queue(d, x);
+    }
+}
+
+static bool dma_readable(const void *p) {
+#if CONFIG_IDF_TARGET_LINUX
+    return display_host_dma_capable(p);
+#else
+    return esp_ptr_dma_capable(p);
+#endif
+}
+
+/* PSRAM (on the ESP32) and flash can't feed the SPI DMA. Such data is
+ * copied through two internal bounce buffers: the CPU fills one while the
+ * other is on the wire, so the copy hides behind the transfer. Without
+ * them the SPI driver would allocate and copy a bounce buffer for every
+ * transaction. */
+static void queue_bounced(display_t *d, const uint8_t *src, int len, display_done_cb_t done_cb, void *arg) {
+    display_pingpong_t *pp = &d->bounce;
+    if (!pp->buf[0] && display_pp_init(pp, d->cfg.max_transfer_sz) != ESP_OK) {
+        queue_chunks(d, src, len, done_cb, arg);
+        return;
+    }
+    for (int offset = 0; offset < len; offset += pp->size) {
+        int chunk = ((len - offset) > pp->size) ? pp->size : (len - offset);
+        bool last = offset + chunk >= len;
+        memcpy(display_pp_next(pp), src + offset, chunk);
+        display_pp_submit_cb(pp, chunk, last ? done_cb : NULL, last ? arg : NULL);
     }
 }
 
+/* Queue raw pixel bytes for the window set last, chunked to stay within
+ * max_transfer_sz. data must stay valid until the transfer completes,
+ * unless the DMA can't read it: then it is copied before this returns. */
+void display_queue_data(const void *data, int len, display_done_cb_t done_cb, void *arg) {
+    display_t *d = display_selected();
+    bool burst = burst_begin(d, len);
+    if (dma_readable(data)) {
+        queue_chunks(d, data, len, done_cb, arg);
+    } else {
+        queue_bounced(d, data, len, done_cb, arg);
+    }
+    if (burst) burst_end(d);
+}
+
+// DMA cannot read flash, so keep the table in DRAM
+DRAM_ATTR static const display_cmd_t ili9341_init_cmds[] = {
+    {0xEF, 3, 0, {0x03, 0x80, 0x02}},
+    {0xCF, 3, 0, {0x00, 0xC1, 0x30}},
+    {0xED, 4, 0, {0x64, 0x03, 0x12, 0x81}},
+    {0xE8, 3, 0, {0x85, 0x00, 0x78}},
+    {0xCB, 5, 0, {0x39, 0x2C, 0x00, 0x34, 0x02}},
+    {0xF7, 1, 0, {0x20}},
+    {0xEA, 2, 0, {0x00, 0x00}},
+    {0xC0, 1, 0, {0x23}},
+    {0xC1, 1, 0, {0x10}},
+    {0xC5, 2, 0, {0x3e, 0x28}},
+    {0xC7, 1, 0, {0x86}},
+    {0x3A, 1, 0, {0x55}},
+    {0xB1, 2, 0, {0x00, 0x18}},
+    {0xB6, 3, 0, {0x08, 0x82, 0x27}},
+    {0xF2, 1, 0, {0x00}},
+    {0x26, 1, 0, {0x01}},
+    {0xE0, 15, 0, {0x0F, 0x31, 0x2B, 0x0C, 0x0E, 0x08, 0x4E, 0xF1, 0x37, 0x07, 0x10, 0x03, 0x0E, 0x09, 0x00}},
+    {0xE1, 15, 0, {0x00, 0x0E, 0x14, 0x03, 0x11, 0x07, 0x31, 0xC1, 0x48, 0x08, 0x0F, 0x0C, 0x31, 0x36, 0x0F}},
+    {0x11, 0, 120, {0}},
+    {0x29, 0, 120, {0}},
+    {0, DISPLAY_CMD_END, 0, {0}},
+};
+
 void ili9341_init(void) {
-    send_cmd(0xEF); uint8_t ef[] = {0x03, 0x80, 0x02}; send_data(ef, 3);
-    send_cmd(0xCF); uint8_t cf[] = {0x00, 0xC1, 0x30}; send_data(cf, 3);
-    send_cmd(0xED); uint8_t ed[] = {0x64, 0x03, 0x12, 0x81}; send_data(ed, 4);
-    send_cmd(0xE8); uint8_t e8[] = {0x85, 0x00, 0x78}; send_data(e8, 3);
-    send_cmd(0xCB); uint8_t cb[] = {0x39, 0x2C, 0x00, 0x34, 0x02}; send_data(cb, 5);
-    send_cmd(0xF7); uint8_t f7[] = {0x20}; send_data(f7, 1);
-    send_cmd(0xEA); uint8_t ea[] = {0x00, 0x00}; send_data(ea, 2);
-    send_cmd(0xC0); uint8_t c0[] = {0x23}; send_data(c0, 1);
-    send_cmd(0xC1); uint8_t c1[] = {0x10}; send_data(c1, 1);
-    send_cmd(0xC5); uint8_t c5[] = {0x3e, 0x28}; send_data(c5, 2);
-    send_cmd(0xC7); uint8_t c7[] = {0x86}; send_data(c7, 1);
-    send_cmd(0x36); uint8_t m[] = {0x48}; send_data(m, 1);
-    send_cmd(0x3A); uint8_t pix[] = {0x55}; send_data(pix, 1);
-    send_cmd(0xB1); uint8_t b1[] = {0x00, 0x18}; send_data(b1, 2);
-    send_cmd(0xB6); uint8_t b6[] = {0x08, 0x82, 0x27}; send_data(b6, 3);
-    send_cmd(0xF2); uint8_t f2[] = {0x00}; send_data(f2, 1);
-    send_cmd(0x26); uint8_t gamma[] = {0x01}; send_data(gamma, 1);
-    send_cmd(0xE0); uint8_t e0[] = {0x0F, 0x31, 0x2B, 0x0C, 0x0E, 0x08, 0x4E, 0xF1, 0x37, 0x07, 0x10, 0x03, 0x0E, 0x09, 0x00}; send_data(e0, 15);
-    send_cmd(0xE1); uint8_t e1[] = {0x00, 0x0E, 0x14, 0x03, 0x11, 0x07, 0x31, 0xC1, 0x48, 0x08, 0x0F, 0x0C, 0x31, 0x36, 0x0F}; send_data(e1, 15);
-    send_cmd(0x11); vTaskDelay(pdMS_TO_TICKS(120));
-    send_cmd(0x29); vTaskDelay(pdMS_TO_TICKS(120));
+    display_t *d = display_selected();
+    queue_cmd(d, 0x36, &d->madctl, 1);   // the table leaves orientation alone
+    display_send_cmd_list(ili9341_init_cmds);
+}
+
+/* With MV set the panel walks its rows along x, so the logical screen is
+ * 320 wide and mirroring x flips the row order (MY) instead of MX. */
+static void madctl_update(display_t *d) {
+    uint8_t m = rotation_madctl[d->rotation];
+    bool mv = m & 0x20;
+    if (d->mirror_x) m ^= mv ? 0x80 : 0x40;
+    if (d->mirror_y) m ^= mv ? 0x40 : 0x80;
+
+    d->madctl = m;
+    d->width = mv ? DISPLAY_PANEL_HEIGHT : DISPLAY_PANEL_WIDTH;
+    d->height = mv ? DISPLAY_PANEL_WIDTH : DISPLAY_PANEL_HEIGHT;
+    queue_cmd(d, 0x36, &d->madctl, 1);
+}
+
+/* The panel does the rotation while writing its memory, so every draw
+ * call keeps streaming pixels row by row in the new orientation. */
+void display_set_rotation(display_rotation_t rot) {
+    display_t *d = display_selected();
+    d->rotation = rot & 3;
+    madctl_update(d);
+}
+
+display_rotation_t display_get_rotation(void) {
+    return display_selected()->rotation;
+}
+
+void display_set_mirror(bool mx, bool my) {
+    display_t *d = display_selected();
+    d->mirror_x = mx;
+    d->mirror_y = my;
+    madctl_update(d);
+}
+
+uint16_t display_width(void) {
+    return display_selected()->width;
+}
+
+uint16_t display_height(void) {
+    return display_selected()->height;
+}
+
+/* Switch the write clock once everything queued has gone out. */
+static esp_err_t bus_set_clock(display_t *d, int clock_hz) {
+    wait_done(d);
+    return d->bus->set_clock(d->bus_dev, clock_hz);
+}
+
+/* Read len bytes answering cmd; the panel inserts dummy_bits clocks before
+ * the data, which the backend strips. */
+static esp_err_t read_reg(display_t *d, uint8_t cmd, uint8_t *out, int len, int dummy_bits) {
+    wait_done(d);
+    return d->bus->read(d->bus_dev, cmd, out, len, dummy_bits);
+}
+
+/* Write a few MADCTL patterns at clock_hz and check each one by reading the
+ * register and the status word back at the safe read clock. */
+static bool verify_clock(display_t *d, int clock_hz, const uint8_t id[3]) {
+    static const uint8_t patterns[] = {0xE8, 0x28, 0x88, 0x48};
+    bool ok = true;
+
+    for (int i = 0; ok && i < (int)sizeof(patterns); i++) {
+        if (bus_set_clock(d, clock_hz) != ESP_OK) {
+            ok = false;
+            break;
+        }
+        send_cmd(0x36);
+        send_data(&patterns[i], 1);
+
+        uint8_t madctl, st[4], rid[3];
+        bus_set_clock(d, READ_CLOCK_HZ);
+        read_reg(d, 0x0B, &madctl, 1, 0);    // RDDMADCTL
+        read_reg(d, 0x09, st, 4, 1);         // RDDST, D31..D25 mirror MADCTL
+        read_reg(d, 0x04, rid, 3, 1);        // RDDID
+        ok = madctl == patterns[i]
+             && (st[0] & 0x7E) == ((patterns[i] >> 1) & 0x7E)
+             && memcmp(rid, id, 3) == 0;
+    }
+
+    bus_set_clock(d, READ_CLOCK_HZ);
+    queue_cmd(d, 0x36, &d->madctl, 1);
+    wait_done(d);
+    return ok;
+}
+
+/* Step the write clock up from the configured speed and keep the fastest
+ * one that passes verify_clock(). Needs MISO wired and a panel already
+ * initialized with ili9341_init(). */
+esp_err_t display_calibrate_clock(int max_hz, int *out_hz) {
+    // The fractions of the 80 MHz APB clock the SPI master can divide down to
+    static const int speeds[] = {
+        10 * 1000 * 1000, 20 * 1000 * 1000, 80 * 1000 * 1000 / 3,
+        40 * 1000 * 1000, 80 * 1000 * 1000,
+    };
+
+    display_t *d = display_selected();
+    uint8_t id[3], st[4];
+    bus_set_clock(d, READ_CLOCK_HZ);
+    esp_err_t ret = read_reg(d, 0x09, st, 4, 1);
+    if (ret != ESP_OK) {
+        bus_set_clock(d, d->cfg.clock_speed_hz);
+        return ret;
+    }
+    // A panel out of sleep reports its booster on; a floating MISO reads
+    // all zeros or all ones. RDDID is no help here, as many ILI9341
+    // modules answer it with zeros.
+    if (!(st[0] & 0x80) || (st[0] & st[1] & st[2] & st[3]) == 0xFF) {
+        bus_set_clock(d, d->cfg.clock_speed_hz);
+        return ESP_ERR_NOT_FOUND;
+    }
+    read_reg(d, 0x04, id, 3, 1);
+
+    int best = d->cfg.clock_speed_hz;
+    for (int i = 0; i < (int)(sizeof(speeds) / sizeof(speeds[0])); i++) {
+        if (speeds[i] <= best || speeds[i] > max_hz) continue;
+        if (!verify_clock(d, speeds[i], id)) break;
+        best = speeds[i];
+    }
+
+    d->cfg.clock_speed_hz = best;
+    if (out_hz) *out_hz = best;
+    return bus_set_clock(d, best);
+}
+
+/* RAMRD walks the window like RAMWR, but answers after a dummy byte and
+ * always with 18-bit pixels, one byte per channel in its top six bits.
+ * The pixels come in pieces that fit one DMA transfer, each after a RAMRD
+ * continue (RAMRDC) that carries on where the previous one stopped. */
+esp_err_t display_read_region(uint16_t x0, uint16_t y0, uint16_t w, uint16_t h, uint16_t *out) {
+    display_t *d = display_selected();
+    if (w == 0 || h == 0 || x0 + w > d->width || y0 + h > d->height) return ESP_ERR_INVALID_ARG;
+
+    uint32_t count = (uint32_t)w * h;
+    uint32_t chunk = d->cfg.max_transfer_sz / 3;
+    if (chunk > count) chunk = count;
+    uint8_t *raw = heap_caps_malloc(chunk * 3, MALLOC_CAP_DMA);
+    if (!raw) return ESP_ERR_NO_MEM;
+
+    queue_window(d, x0, y0, x0 + w - 1, y0 + h - 1);
+    // Nothing is read unless the read clock took: at write speed the
+    // panel answers garbage
+    esp_err_t ret = bus_set_clock(d, READ_CLOCK_HZ);
+    uint8_t cmd = 0x2E;
+    uint32_t done = 0;
+    while (ret == ESP_OK && done < count) {
+        uint32_t n = (count - done > chunk) ? chunk : count - done;
+        ret = read_reg(d, cmd, raw, n * 3, 8);
+        if (ret != ESP_OK) break;
+        for (uint32_t i = 0; i < n; i++) {
+            const uint8_t *p = raw + i * 3;
+            uint16_t c = ((p[0] >> 3) << 11) | ((p[1] >> 2) << 5) | (p[2] >> 3);
+            out[done + i] = DISPLAY_SWAP16(c);
+        }
+        done += n;
+        cmd = 0x3E;
+    }
+
+    // Back to the write clock however the read went
+    esp_err_t restore = bus_set_clock(d, d->cfg.clock_speed_hz);
+    heap_caps_free(raw);
+    return ret != ESP_OK ? ret : restore;
 }
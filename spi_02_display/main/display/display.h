@@ -1,17 +1,193 @@
 #ifndef DISPLAY_H
 #define DISPLAY_H
 
-#include "driver/spi_master.h"
+#include "sdkconfig.h"
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include <stdbool.h>
 #include <stdint.h>
 
+#if CONFIG_IDF_TARGET_LINUX
+#define DISPLAY_HOST_DEFAULT 0
+#else
+#include "driver/spi_master.h"
+#define DISPLAY_HOST_DEFAULT SPI2_HOST
+#endif
+
+// Bus backends (display_bus.h). display_bus_host is an ILI9341 emulator
+// that decodes the command stream into memory (display_host.h); it is the
+// only one available on the linux target.
+typedef struct display_bus display_bus_t;
+
+#if !CONFIG_IDF_TARGET_LINUX
+extern const display_bus_t display_bus_spi;
+#endif
+extern const display_bus_t display_bus_host;
+
+// Bus, pins and transfer size of the panel. Pins set to -1 are unused
+// (MISO is only needed for display_calibrate_clock() and readback).
+typedef struct {
+    const display_bus_t *bus;   // NULL: SPI master (emulator on linux)
+    int host;               // spi_host_device_t
+    int pin_mosi;
+    int pin_miso;
+    int pin_clk;
+    int pin_cs;
+    int pin_dc;
+    int pin_rst;
+    int pin_led;
+    int pin_te;             // tearing-effect output of the panel
+    int clock_speed_hz;
+    int max_transfer_sz;    // bytes per DMA transaction
+    int burst_bytes;        // hold a shared bus for runs this long, 0: never (see display_create())
+} display_config_t;
+
+#define DISPLAY_CONFIG_DEFAULT() {          \
+    .bus = NULL,                            \
+    .host = DISPLAY_HOST_DEFAULT,           \
+    .pin_mosi = 23,                         \
+    .pin_miso = -1,                         \
+    .pin_clk = 19,                          \
+    .pin_cs = 5,                            \
+    .pin_dc = 2,                            \
+    .pin_rst = 4,                           \
+    .pin_led = 15,                          \
+    .pin_te = -1,                           \
+    .clock_speed_hz = 10 * 1000 * 1000,     \
+    .max_transfer_sz = 4096,                \
+    .burst_bytes = 0,                       \
+}
+
+void display_configure(const display_config_t *config);
+const display_config_t *display_get_config(void);
+
 void display_gpio_init(void);
-void display_spi_init(void);
+esp_err_t display_spi_init(void);
 void ili9341_init(void);
+
+// Several panels, each with its own CS, DC, RST, transfers and orientation,
+// can share one SPI host (and share it with an SPI flash). The calls above
+// set up a default panel; display_create() adds another, joining the bus
+// the first one brought up (or bringing it up itself). Every other call in
+// this driver acts on the panel selected by the calling task, the default
+// one until display_select() picks another; scroll areas and TE pacing are
+// kept per panel. The framebuffer and the render task serve one panel at a
+// time: the one selected when they are set up.
+//
+// The SPI driver interleaves the devices on a host one transaction at a
+// time. With burst_bytes set, runs at least that long (fills, image blits)
+// hold the bus for burst_bytes at a time instead and stream without
+// arbitration, handing it back between quanta so no other device waits
+// longer than one quantum; such runs return once they have been sent.
+// 16-32 KB keeps the bus busy while bounding the flash's wait to a
+// millisecond or two at 40 MHz.
+typedef struct display display_t;
+
+esp_err_t display_create(const display_config_t *config, display_t **out);
+void display_select(display_t *disp);   // NULL: the default panel
+display_t *display_selected(void);
 void fill_color(uint16_t color);
 
+// Orientation, applied by the panel through MADCTL: drawing costs the same
+// in every rotation. Coordinates everywhere are logical, display_width() x
+// display_height() (240x320 or 320x240). Content already on the panel is
+// not moved; framebuffers and scenes should be redrawn after a change.
+typedef enum {
+    DISPLAY_ROTATION_0,         // portrait, the default
+    DISPLAY_ROTATION_90,        // landscape
+    DISPLAY_ROTATION_180,
+    DISPLAY_ROTATION_270,
+} display_rotation_t;
+
+void display_set_rotation(display_rotation_t rotation);
+display_rotation_t display_get_rotation(void);
+void display_set_mirror(bool mirror_x, bool mirror_y);
+uint16_t display_width(void);
+uint16_t display_height(void);
+
+// Command tables: each entry is a command byte, its parameters and an
+// optional delay after it. The list ends with an entry whose len is
+// DISPLAY_CMD_END. Keep tables in DRAM (DRAM_ATTR) so DMA can read them.
+#define DISPLAY_CMD_END 0xFF
+
+typedef struct {
+    uint8_t cmd;
+    uint8_t len;
+    uint8_t delay_ms;
+    uint8_t data[15];
+} display_cmd_t;
+
+void display_send_cmd_list(const display_cmd_t *list);
+
+// Find the fastest write clock (up to max_hz) this board sustains, verified
+// by register readback over MISO, and switch the bus to it. Pins routed
+// through the GPIO matrix top out at 40 MHz; 80 MHz needs the IO_MUX pins.
+esp_err_t display_calibrate_clock(int max_hz, int *out_hz);
+
+// Read a rectangle of panel memory back over MISO (RAMRD, at the slow read
+// clock) into out: w * h pixels in panel order, as draw_image() takes them,
+// so they can be drawn again as they are. Without pin_miso it fails with
+// ESP_ERR_NOT_SUPPORTED. It reads what was written, not the scrolled
+// picture. See display_readback.h for screenshots and blending.
+esp_err_t display_read_region(uint16_t x0, uint16_t y0, uint16_t w, uint16_t h, uint16_t *out);
+
 // New functions
+// Fills are queued and return at once; draw_image() returns once the image
+// has been sent, since the caller owns the pixels.
 void clear_screen(uint16_t color);
 void clear_region(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
 void draw_image(uint16_t x0, uint16_t y0, uint16_t w, uint16_t h, const uint16_t *image_data);
 
+// Queued (DMA pipelined) transfers
+// done_cb runs from the SPI interrupt once the last byte is on the wire,
+// so keep it short (e.g. give a semaphore or notify a task).
+typedef void (*display_done_cb_t)(void *arg);
+
+void draw_image_async(uint16_t x0, uint16_t y0, uint16_t w, uint16_t h, const uint16_t *image_data,
+                      display_done_cb_t done_cb, void *arg);
+void display_wait_done(void);
+
+// Bus counters since the last reset. blocked_us is time spent waiting for
+// the bus to finish transfers (a free pool slot, display_wait_done()).
+typedef struct {
+    uint64_t bytes;
+    uint32_t transactions;
+    int64_t blocked_us;
+} display_stats_t;
+
+void display_stats_get(display_stats_t *out);
+void display_stats_reset(void);
+
+// Hardware vertical scrolling (VSCRDEF/VSCRSADD). Rows are panel memory
+// rows; after display_scroll_advance() only the returned rows need drawing.
+// In landscape they run along x, so the picture scrolls sideways.
+void display_scroll_define(uint16_t top_fixed, uint16_t bottom_fixed);
+void display_scroll_to(uint16_t line);
+uint16_t display_scroll_row(uint16_t visible_row);
+uint16_t display_scroll_advance(uint16_t lines);
+void display_scroll_reset(void);
+
+// Tearing-free pacing. With pin_te wired, display_te_enable() turns on the
+// panel's TE output and display_wait_vsync() blocks until V-blank starts;
+// the framebuffer flush task then starts every frame on that edge.
+esp_err_t display_te_enable(void);
+void display_te_disable(void);
+bool display_te_enabled(void);
+esp_err_t display_wait_vsync(TickType_t timeout);
+int display_set_frame_rate(int hz);
+int display_get_frame_rate(void);
+
+typedef struct {
+    int interval;           // panel refreshes per frame
+    uint32_t frames;
+    uint32_t missed;        // frames that came after their slot
+    int64_t start_us;
+    uint32_t next_vsync;
+    int64_t next_us;        // timer slot of the next frame without TE
+} display_pacer_t;
+
+void display_pacer_init(display_pacer_t *pacer, int target_fps);
+void display_pacer_wait(display_pacer_t *pacer);
+float display_pacer_fps(const display_pacer_t *pacer);
+
 #endif
@@ -0,0 +1,225 @@
+#include "display_band.h"
+#include "display_priv.h"
+#include "esp_heap_caps.h"
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Sprite expansion state shared by all bands of a render: the LUT is only
+// rebuilt when a sprite with another palette or depth comes along.
+static display_sprite_lut_t *sprite_lut;
+static const uint16_t *sprite_lut_palette;
+static uint16_t *sprite_row;
+static int sprite_row_pixels;
+
+void display_list_init(display_list_t *list, display_prim_t *storage, int capacity, uint16_t bg) {
+    list->prims = storage;
+    list->capacity = capacity;
+    list->count = 0;
+    list->bg = bg;
+}
+
+void display_list_clear(display_list_t *list) {
+    list->count = 0;
+}
+
+static display_prim_t prim_box(display_prim_type_t type, int16_t x, int16_t y, uint16_t w, uint16_t h) {
+    display_prim_t p;
+    memset(&p, 0, sizeof(p));
+    p.type = type;
+    p.x = x;
+    p.y = y;
+    p.w = w;
+    p.h = h;
+    return p;
+}
+
+display_prim_t display_prim_fill(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    display_prim_t p = prim_box(DISPLAY_PRIM_FILL, x, y, w, h);
+    p.fill.color = color;
+    return p;
+}
+
+display_prim_t display_prim_image(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t *pixels) {
+    display_prim_t p = prim_box(DISPLAY_PRIM_IMAGE, x, y, w, h);
+    p.image.pixels = pixels;
+    return p;
+}
+
+display_prim_t display_prim_sprite(int16_t x, int16_t y, const display_sprite_t *sprite) {
+    display_prim_t p = prim_box(DISPLAY_PRIM_SPRITE, x, y, sprite->width, sprite->height);
+    p.sprite.sprite = sprite;
+    return p;
+}
+
+display_prim_t display_prim_text(int16_t x, int16_t y, const char *str, const display_font_t *font,
+                                 uint16_t color) {
+    display_prim_t p = prim_box(DISPLAY_PRIM_TEXT, x, y, display_text_width(font, str), font->line_height);
+    p.text.str = str;
+    p.text.font = font;
+    p.text.color = color;
+    return p;
+}
+
+display_prim_t display_prim_alpha(int16_t x, int16_t y, const display_alpha_sprite_t *sprite, uint8_t opacity) {
+    display_prim_t p = prim_box(DISPLAY_PRIM_ALPHA, x, y, sprite->width, sprite->height);
+    p.alpha.sprite = sprite;
+    p.alpha.opacity = opacity;
+    return p;
+}
+
+display_prim_t display_prim_shape(const display_shape_t *shape) {
+    int x0, y0, x1, y1;
+    display_shape_bounds(shape, &x0, &y0, &x1, &y1);
+    display_prim_t p = prim_box(DISPLAY_PRIM_SHAPE, x0, y0, x1 - x0 + 1, y1 - y0 + 1);
+    p.shape.shape = shape;
+    return p;
+}
+
+display_prim_t *display_list_add(display_list_t *list, const display_prim_t *prim) {
+    if (list->count == list->capacity) return NULL;
+    display_prim_t *p = &list->prims[list->count++];
+    *p = *prim;
+    return p;
+}
+
+display_prim_t *display_list_add_fill(display_list_t *list, int16_t x, int16_t y, uint16_t w, uint16_t h,
+                                      uint16_t color) {
+    display_prim_t p = display_prim_fill(x, y, w, h, color);
+    return display_list_add(list, &p);
+}
+
+display_prim_t *display_list_add_image(display_list_t *list, int16_t x, int16_t y, uint16_t w, uint16_t h,
+                                       const uint16_t *pixels) {
+    display_prim_t p = display_prim_image(x, y, w, h, pixels);
+    return display_list_add(list, &p);
+}
+
+display_prim_t *display_list_add_sprite(display_list_t *list, int16_t x, int16_t y,
+                                        const display_sprite_t *sprite) {
+    display_prim_t p = display_prim_sprite(x, y, sprite);
+    return display_list_add(list, &p);
+}
+
+display_prim_t *display_list_add_text(display_list_t *list, int16_t x, int16_t y, const char *str,
+                                      const display_font_t *font, uint16_t color) {
+    display_prim_t p = display_prim_text(x, y, str, font, color);
+    return display_list_add(list, &p);
+}
+
+display_prim_t *display_list_add_alpha(display_list_t *list, int16_t x, int16_t y,
+                                       const display_alpha_sprite_t *sprite, uint8_t opacity) {
+    display_prim_t p = display_prim_alpha(x, y, sprite, opacity);
+    return display_list_add(list, &p);
+}
+
+display_prim_t *display_list_add_shape(display_list_t *list, const display_shape_t *shape) {
+    display_prim_t p = display_prim_shape(shape);
+    return display_list_add(list, &p);
+}
+
+static bool sprite_prepare(const display_sprite_t *s) {
+    if (!sprite_lut) {
+        sprite_lut = malloc(sizeof(*sprite_lut));
+        if (!sprite_lut) return false;
+        sprite_lut_palette = NULL;
+    }
+    if (sprite_lut_palette != s->palette || sprite_lut->bpp != s->bpp) {
+        display_sprite_build_lut(sprite_lut, s->palette, s->bpp);
+        sprite_lut_palette = s->palette;
+    }
+
+    int need = display_sprite_row_pixels(s);
+    if (need > sprite_row_pixels) {
+        heap_caps_free(sprite_row);
+        sprite_row = heap_caps_malloc(need * 2, MALLOC_CAP_32BIT);
+        sprite_row_pixels = sprite_row ? need : 0;
+    }
+    return sprite_row != NULL;
+}
+
+void display_prim_render(const display_prim_t *p, uint16_t *buf, int buf_x, int buf_y, int buf_w, int buf_h) {
+    // Clip the bounding box to the buffer
+    int x0 = p->x > buf_x ? p->x : buf_x;
+    int y0 = p->y > buf_y ? p->y : buf_y;
+    int x1 = (p->x + p->w < buf_x + buf_w) ? p->x + p->w : buf_x + buf_w;
+    int y1 = (p->y + p->h < buf_y + buf_h) ? p->y + p->h : buf_y + buf_h;
+    if (x1 <= x0 || y1 <= y0) return;
+    int n = x1 - x0;
+
+    switch (p->type) {
+    case DISPLAY_PRIM_FILL: {
+        uint16_t c = DISPLAY_SWAP16(p->fill.color);
+        for (int y = y0; y < y1; y++) {
+            uint16_t *dst = buf + (y - buf_y) * buf_w + (x0 - buf_x);
+            for (int i = 0; i < n; i++) {
+                dst[i] = c;
+            }
+        }
+        break;
+    }
+    case DISPLAY_PRIM_IMAGE:
+        for (int y = y0; y < y1; y++) {
+            memcpy(buf + (y - buf_y) * buf_w + (x0 - buf_x),
+                   p->image.pixels + (y - p->y) * p->w + (x0 - p->x), n * 2);
+        }
+        break;
+    case DISPLAY_PRIM_SPRITE:
+        if (!sprite_prepare(p->sprite.sprite)) break;
+        for (int y = y0; y < y1; y++) {
+            display_sprite_expand_row(sprite_lut, p->sprite.sprite, y - p->y, sprite_row);
+            memcpy(buf + (y - buf_y) * buf_w + (x0 - buf_x), sprite_row + (x0 - p->x), n * 2);
+        }
+        break;
+    case DISPLAY_PRIM_TEXT:
+        display_text_render(p->text.font, p->text.str, p->x, p->y, p->text.color, NULL,
+                            buf, buf_x, buf_y, buf_w, buf_h);
+        break;
+    case DISPLAY_PRIM_ALPHA:
+        display_blend_sprite(p->alpha.sprite, p->x, p->y, p->alpha.opacity, buf, buf_x, buf_y, buf_w, buf_h);
+        break;
+    case DISPLAY_PRIM_SHAPE:
+        display_shape_render(p->shape.shape, buf, buf_x, buf_y, buf_w, buf_h);
+        break;
+    }
+}
+
+esp_err_t display_list_render_region(const display_list_t *list, uint16_t x0, uint16_t y0,
+                                     uint16_t x1, uint16_t y1) {
+    if (x1 >= display_width()) x1 = display_width() - 1;
+    if (y1 >= display_height()) y1 = display_height() - 1;
+    if (x1 < x0 || y1 < y0) return ESP_ERR_INVALID_ARG;
+
+    int w = x1 - x0 + 1;
+    display_pingpong_t pp;
+    esp_err_t ret = display_pp_init(&pp, w * DISPLAY_BAND_ROWS * 2);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    set_window(x0, y0, x1, y1);
+
+    uint16_t bg = DISPLAY_SWAP16(list->bg);
+    for (int y = y0; y <= y1; y += DISPLAY_BAND_ROWS) {
+        int rows = (y1 + 1 - y < DISPLAY_BAND_ROWS) ? y1 + 1 - y : DISPLAY_BAND_ROWS;
+        uint16_t *band = (uint16_t *)display_pp_next(&pp);
+
+        for (int i = 0; i < w * rows; i++) {
+            band[i] = bg;
+        }
+        for (int i = 0; i < list->count; i++) {
+            const display_prim_t *p = &list->prims[i];
+            if (p->y < y + rows && p->y + p->h > y && p->x <= x1 && p->x + p->w > x0) {
+                display_prim_render(p, band, x0, y, w, rows);
+            }
+        }
+        display_pp_submit(&pp, w * rows * 2);
+    }
+
+    display_pp_free(&pp);
+    return ESP_OK;
+}
+
+esp_err_t display_list_render(const display_list_t *list) {
+    return display_list_render_region(list, 0, 0, display_width() - 1, display_height() - 1);
+}
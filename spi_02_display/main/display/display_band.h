@@ -0,0 +1,103 @@
+#ifndef DISPLAY_BAND_H
+#define DISPLAY_BAND_H
+
+#include "esp_err.h"
+#include "display_font.h"
+#include "display_sprite.h"
+#include "display_blend.h"
+#include "display_shape.h"
+#include <stdint.h>
+
+/*
+ * Band renderer: a display list of primitives is rasterized into horizontal
+ * bands of DISPLAY_BAND_ROWS rows that are double-buffered and sent while
+ * the next band renders. A full-screen composition needs two 240x16 bands
+ * (15 KB) instead of a 150 KB framebuffer.
+ *
+ * Primitives are drawn in list order, later ones on top. The list only
+ * references its pixel data, strings, sprites and shapes; they must stay valid
+ * while the list is rendered.
+ */
+
+#define DISPLAY_BAND_ROWS 16
+
+typedef enum {
+    DISPLAY_PRIM_FILL,
+    DISPLAY_PRIM_IMAGE,     // RGB565 pixels, draw_image() layout
+    DISPLAY_PRIM_SPRITE,
+    DISPLAY_PRIM_TEXT,      // transparent text, blended over what is below
+    DISPLAY_PRIM_ALPHA,     // alpha sprite, blended over what is below
+    DISPLAY_PRIM_SHAPE,     // line, polyline, circle or rounded box
+} display_prim_type_t;
+
+typedef struct {
+    display_prim_type_t type;
+    int16_t x, y;           // bounding box
+    uint16_t w, h;
+    union {
+        struct {
+            uint16_t color;
+        } fill;
+        struct {
+            const uint16_t *pixels;
+        } image;
+        struct {
+            const display_sprite_t *sprite;
+        } sprite;
+        struct {
+            const char *str;
+            const display_font_t *font;
+            uint16_t color;
+        } text;
+        struct {
+            const display_alpha_sprite_t *sprite;
+            uint8_t opacity;
+        } alpha;
+        struct {
+            const display_shape_t *shape;
+        } shape;
+    };
+} display_prim_t;
+
+typedef struct {
+    display_prim_t *prims;
+    int count;
+    int capacity;
+    uint16_t bg;            // color under all primitives
+} display_list_t;
+
+// Primitive constructors, usable for lists and for retained widgets
+display_prim_t display_prim_fill(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color);
+display_prim_t display_prim_image(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t *pixels);
+display_prim_t display_prim_sprite(int16_t x, int16_t y, const display_sprite_t *sprite);
+display_prim_t display_prim_text(int16_t x, int16_t y, const char *str, const display_font_t *font,
+                                 uint16_t color);
+display_prim_t display_prim_alpha(int16_t x, int16_t y, const display_alpha_sprite_t *sprite, uint8_t opacity);
+display_prim_t display_prim_shape(const display_shape_t *shape);
+
+void display_list_init(display_list_t *list, display_prim_t *storage, int capacity, uint16_t bg);
+void display_list_clear(display_list_t *list);
+display_prim_t *display_list_add(display_list_t *list, const display_prim_t *prim);
+
+// Each returns the new primitive, or NULL when the list is full
+display_prim_t *display_list_add_fill(display_list_t *list, int16_t x, int16_t y, uint16_t w, uint16_t h,
+                                      uint16_t color);
+display_prim_t *display_list_add_image(display_list_t *list, int16_t x, int16_t y, uint16_t w, uint16_t h,
+                                       const uint16_t *pixels);
+display_prim_t *display_list_add_sprite(display_list_t *list, int16_t x, int16_t y,
+                                        const display_sprite_t *sprite);
+display_prim_t *display_list_add_text(display_list_t *list, int16_t x, int16_t y, const char *str,
+                                      const display_font_t *font, uint16_t color);
+display_prim_t *display_list_add_alpha(display_list_t *list, int16_t x, int16_t y,
+                                       const display_alpha_sprite_t *sprite, uint8_t opacity);
+display_prim_t *display_list_add_shape(display_list_t *list, const display_shape_t *shape);
+
+// Rasterize one primitive into a panel-order buffer covering the screen
+// rectangle (buf_x, buf_y, buf_w x buf_h), clipped to it.
+void display_prim_render(const display_prim_t *prim, uint16_t *buf, int buf_x, int buf_y, int buf_w, int buf_h);
+
+esp_err_t display_list_render(const display_list_t *list);
+esp_err_t display_list_render_region(const display_list_t *list, uint16_t x0, uint16_t y0,
+                                     uint16_t x1, uint16_t y1);
+
+#endif
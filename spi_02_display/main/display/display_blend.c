@@ -0,0 +1,182 @@
+#include "display_blend.h"
+#include "display_priv.h"
+#include <string.h>
+
+// Pixels blended per pass where a row of color or scaled alpha is staged
+#define BLEND_RUN 64
+
+// 0..15 coverage to the 0..32 blend scale
+static const uint8_t a4_to_a32[16] = {
+    0, 2, 4, 6, 9, 11, 13, 15, 17, 19, 21, 23, 26, 28, 30, 32,
+};
+
+/* Byte-swap both pixels of a word: panel order <-> CPU order. */
+static inline uint32_t swap_pair(uint32_t w) {
+    return ((w >> 8) & 0x00FF00FF) | ((w << 8) & 0xFF00FF00);
+}
+
+/* One pixel: green moves to the upper half-word, leaving room above red,
+ * green and blue for the product with a 0..32 alpha. */
+static inline uint16_t blend_px(uint16_t dst, uint16_t src, uint32_t a) {
+    uint32_t b = DISPLAY_SWAP16(dst);
+    uint32_t f = DISPLAY_SWAP16(src);
+    b = (b | (b << 16)) & 0x07E0F81F;
+    f = (f | (f << 16)) & 0x07E0F81F;
+    b = (b + (((f - b) * a) >> 5)) & 0x07E0F81F;
+    return DISPLAY_SWAP16((uint16_t)(b | (b >> 16)));
+}
+
+/* Two CPU-order pixels per word with the same alpha: each channel of both
+ * pixels is isolated into its own 16-bit lane, where a 6-bit value times
+ * 32 still fits, and the two lanes multiply at once. */
+static inline uint32_t blend_pair(uint32_t b, uint32_t f, uint32_t a, uint32_t na) {
+    uint32_t bl = (f & 0x001F001F) * a + (b & 0x001F001F) * na;
+    uint32_t gr = ((f >> 5) & 0x003F003F) * a + ((b >> 5) & 0x003F003F) * na;
+    uint32_t rd = ((f >> 11) & 0x001F001F) * a + ((b >> 11) & 0x001F001F) * na;
+    return ((bl >> 5) & 0x001F001F) | (gr & 0x07E007E0) | ((rd << 6) & 0xF800F800);
+}
+
+void display_blend_row(uint16_t *dst, const uint16_t *src, int n, uint8_t alpha) {
+    uint32_t a = (alpha + 4) >> 3;
+    uint32_t na = 32 - a;
+    int i = 0;
+
+    if (a == 0 || n <= 0) return;
+    if (a == 32) {
+        memcpy(dst, src, n * 2);
+        return;
+    }
+
+    if ((uintptr_t)dst & 2) {
+        dst[0] = blend_px(dst[0], src[0], a);
+        i = 1;
+    }
+    for (; i + 2 <= n; i += 2) {
+        uint32_t *d = (uint32_t *)(dst + i);
+        uint32_t f = src[i] | ((uint32_t)src[i + 1] << 16);     // src may be misaligned
+        *d = swap_pair(blend_pair(swap_pair(*d), swap_pair(f), a, na));
+    }
+    if (i < n) {
+        dst[i] = blend_px(dst[i], src[i], a);
+    }
+}
+
+void display_blend_row_a8(uint16_t *dst, const uint16_t *src, const uint8_t *alpha, int n) {
+    int i = 0;
+
+    // Four mask bytes at a time: skip clear words, copy solid ones
+    for (; i + 4 <= n; i += 4) {
+        uint32_t m;
+        memcpy(&m, alpha + i, 4);
+        if (m == 0) continue;
+        if (m == 0xFFFFFFFF) {
+            memcpy(dst + i, src + i, 8);
+            continue;
+        }
+        for (int k = i; k < i + 4; k++) {
+            uint32_t a = (alpha[k] + 4) >> 3;
+            if (a == 32) dst[k] = src[k];
+            else if (a) dst[k] = blend_px(dst[k], src[k], a);
+        }
+    }
+    for (; i < n; i++) {
+        uint32_t a = (alpha[i] + 4) >> 3;
+        if (a == 32) dst[i] = src[i];
+        else if (a) dst[i] = blend_px(dst[i], src[i], a);
+    }
+}
+
+static inline void blend_a4_px(uint16_t *dst, uint16_t src, int coverage) {
+    uint32_t a = a4_to_a32[coverage];
+    if (a == 32) *dst = src;
+    else if (a) *dst = blend_px(*dst, src, a);
+}
+
+void display_blend_row_a4(uint16_t *dst, const uint16_t *src, const uint8_t *alpha, int first, int n) {
+    const uint8_t *m = alpha + first / 2;
+    int i = 0;
+
+    if (n <= 0) return;
+    if (first & 1) {
+        blend_a4_px(dst, src[0], *m++ & 15);
+        i = 1;
+    }
+    // Two mask bytes cover four pixels
+    for (; i + 4 <= n; i += 4, m += 2) {
+        uint16_t w = m[0] | (m[1] << 8);
+        if (w == 0) continue;
+        if (w == 0xFFFF) {
+            memcpy(dst + i, src + i, 8);
+            continue;
+        }
+        blend_a4_px(dst + i, src[i], m[0] >> 4);
+        blend_a4_px(dst + i + 1, src[i + 1], m[0] & 15);
+        blend_a4_px(dst + i + 2, src[i + 2], m[1] >> 4);
+        blend_a4_px(dst + i + 3, src[i + 3], m[1] & 15);
+    }
+    for (; i < n; i++) {
+        int nib = ((first + i) & 1) ? (*m++ & 15) : (*m >> 4);
+        blend_a4_px(dst + i, src[i], nib);
+    }
+}
+
+/* A run of one row. With an opacity below 255 the mask is scaled into a
+ * staging row first, which then goes through the A8 kernel. */
+static void blend_run(uint16_t *dst, const uint16_t *src, const display_alpha_sprite_t *s,
+                      const uint8_t *arow, int first, int n, uint8_t opacity) {
+    if (!arow) {
+        display_blend_row(dst, src, n, opacity);
+        return;
+    }
+    if (opacity == 255) {
+        if (s->alpha_bits == 4) display_blend_row_a4(dst, src, arow, first, n);
+        else display_blend_row_a8(dst, src, arow + first, n);
+        return;
+    }
+
+    uint8_t scaled[BLEND_RUN];
+    for (int k = 0; k < n; k += BLEND_RUN) {
+        int m = (n - k < BLEND_RUN) ? n - k : BLEND_RUN;
+        for (int i = 0; i < m; i++) {
+            int p = first + k + i;
+            int a = (s->alpha_bits == 4) ? ((arow[p / 2] >> ((p & 1) ? 0 : 4)) & 15) * 17 : arow[p];
+            scaled[i] = (a * (opacity + 1)) >> 8;
+        }
+        display_blend_row_a8(dst + k, src + k, scaled, m);
+    }
+}
+
+void display_blend_sprite(const display_alpha_sprite_t *s, int x, int y, uint8_t opacity,
+                          uint16_t *buf, int buf_x, int buf_y, int buf_w, int buf_h) {
+    int x0 = x > buf_x ? x : buf_x;
+    int y0 = y > buf_y ? y : buf_y;
+    int x1 = (x + s->width < buf_x + buf_w) ? x + s->width : buf_x + buf_w;
+    int y1 = (y + s->height < buf_y + buf_h) ? y + s->height : buf_y + buf_h;
+    if (x1 <= x0 || y1 <= y0 || opacity == 0) return;
+
+    int n = x1 - x0;
+    int sx = x0 - x;
+    int astride = (s->alpha_bits == 4) ? (s->width + 1) / 2 : s->width;
+
+    // Mask-only sprites blend a staged run of their color
+    uint16_t color_run[BLEND_RUN];
+    int run = n;
+    if (!s->pixels) {
+        uint16_t c = DISPLAY_SWAP16(s->color);
+        for (int i = 0; i < BLEND_RUN; i++) {
+            color_run[i] = c;
+        }
+        run = BLEND_RUN;
+    }
+
+    for (int row = y0; row < y1; row++) {
+        uint16_t *dst = buf + (row - buf_y) * buf_w + (x0 - buf_x);
+        const uint16_t *src = s->pixels ? s->pixels + (row - y) * s->width + sx : color_run;
+        const uint8_t *arow = s->alpha ? s->alpha + (row - y) * astride : NULL;
+
+        for (int k = 0; k < n; k += run) {
+            int m = (n - k < run) ? n - k : run;
+            blend_run(dst + k, s->pixels ? src + k : src, s, arow, sx + k, m, opacity);
+        }
+    }
+}
@@ -0,0 +1,39 @@
+#ifndef DISPLAY_BLEND_H
+#define DISPLAY_BLEND_H
+
+#include <stdint.h>
+
+/*
+ * Alpha compositing of RGB565 pixels in panel (byte-swapped) order, the
+ * layout of bands and of the framebuffer.
+ *
+ * Alpha is quantized to 0..32 so all three channels of a pixel blend with
+ * one multiply (the pixel is spread over a 32-bit word with gaps between
+ * the fields). With one alpha for a whole run, two pixels share each word
+ * and are blended together. Masks are scanned a word at a time, so fully
+ * transparent and fully opaque stretches cost a compare and a copy.
+ */
+
+// Color plus optional alpha plane. A4 packs two pixels per byte, high
+// nibble first; alpha rows start on a byte boundary.
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    const uint16_t *pixels;     // panel order like draw_image(); NULL: color
+    uint16_t color;             // RGB565, for mask-only sprites (icons, cursors)
+    const uint8_t *alpha;       // NULL: opaque
+    uint8_t alpha_bits;         // 4 or 8
+} display_alpha_sprite_t;
+
+// Row kernels: blend n src pixels over dst. Both need only 2-byte alignment.
+void display_blend_row(uint16_t *dst, const uint16_t *src, int n, uint8_t alpha);
+void display_blend_row_a8(uint16_t *dst, const uint16_t *src, const uint8_t *alpha, int n);
+// first is the index of src[0] within the A4 alpha row
+void display_blend_row_a4(uint16_t *dst, const uint16_t *src, const uint8_t *alpha, int first, int n);
+
+// Composite a sprite placed at (x, y), scaled by opacity (255 = as is), into
+// a panel-order buffer covering (buf_x, buf_y, buf_w x buf_h), clipped to it.
+void display_blend_sprite(const display_alpha_sprite_t *sprite, int x, int y, uint8_t opacity,
+                          uint16_t *buf, int buf_x, int buf_y, int buf_w, int buf_h);
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef DISPLAY_BUS_H
+#define DISPLAY_BUS_H
+
+// Bus backends: what display.c talks to instead of the SPI driver. The core
+// owns the transfer pool and the command encoding; a backend only moves
+// bytes with the DC level attached and reports them done in queue order.
+
+#include "display.h"
+#include <stdint.h>
+
+// Transfers a backend must accept in flight before its queue() may block.
+#define DISPLAY_BUS_DEPTH 40
+
+// The ILI9341 serial read cycle is much slower than its write cycle
+// (~150 ns), so readback always runs at this clock.
+#define READ_CLOCK_HZ (6 * 1000 * 1000)
+
+typedef struct {
+    const void *tx;             // NULL: the bytes are in data[]
+    uint32_t len;               // bytes
+    uint8_t data[4];
+    uint8_t dc;                 // level of the DC pin during the transfer
+    display_done_cb_t done_cb;  // called once the last byte is out
+    void *done_arg;
+} display_xfer_t;
+
+// A backend keeps whatever it needs per panel in *dev, which starts out
+// NULL. reset() may come before or after init().
+struct display_bus {
+    const char *name;
+    // Pins and hardware reset; called from display_gpio_init().
+    void (*reset)(void **dev, const display_config_t *cfg);
+    // Bring the panel's device up at cfg->clock_speed_hz, and the bus with
+    // it unless another panel already did; called from display_spi_init().
+    esp_err_t (*init)(void **dev, const display_config_t *cfg);
+    // Start a transfer. x stays owned by the backend until the reap() that
+    // collects it returns.
+    void (*queue)(void *dev, display_xfer_t *x);
+    // Wait for the oldest transfer still in flight.
+    void (*reap)(void *dev);
+    // The core only calls these with nothing in flight.
+    esp_err_t (*set_clock)(void *dev, int clock_hz);
+    // Send cmd and read len bytes after dummy_bits clocks, with the dummy
+    // bits stripped. Long reads (RAMRD) only come with whole dummy bytes.
+    esp_err_t (*read)(void *dev, uint8_t cmd, uint8_t *out, int len, int dummy_bits);
+    // Optional: keep the bus to this panel alone until release(), locking
+    // the other devices on it out.
+    esp_err_t (*acquire)(void *dev);
+    void (*release)(void *dev);
+    // Call isr on every rising TE edge; isr == NULL detaches it.
+    esp_err_t (*te_attach)(void *dev, display_done_cb_t isr, void *arg);
+};
+
+// Backend and backend state of the selected panel
+const display_bus_t *display_bus(void);
+void *display_bus_dev(void);
+
+#endif
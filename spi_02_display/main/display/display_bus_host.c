@@ -0,0 +1,385 @@
+#include "display.h"
+#include "display_bus.h"
+#include "display_host.h"
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Host backend: an ILI9341 model fed byte by byte. Transfers complete as
+// soon as they are queued, so done callbacks run from the caller's context.
+
+#define W DISPLAY_HOST_WIDTH
+#define H DISPLAY_HOST_HEIGHT
+
+typedef struct {
+    uint16_t *mem;              // panel memory, W x H, CPU byte order
+    uint8_t cmd;                // command the data bytes belong to
+    uint8_t param[6];
+    int nparam;
+    uint8_t px[3];              // partial pixel carried across transfers
+    int npx;
+    uint16_t xs, xe, ys, ye;    // CASET/RASET window
+    uint16_t x, y;              // RAMWR cursor
+    uint8_t madctl;
+    uint8_t colmod;
+    uint16_t tfa, vsa, vsp;     // VSCRDEF/VSCRSADD
+    bool scrolling;
+    bool inverted;
+    bool awake;
+    bool on;
+    uint32_t pending;           // queued transfers not yet reaped
+} emu_t;
+
+static void emu_regs_reset(emu_t *e) {
+    e->cmd = 0x00;
+    e->nparam = 0;
+    e->npx = 0;
+    e->xs = 0;
+    e->xe = W - 1;
+    e->ys = 0;
+    e->ye = H - 1;
+    e->x = e->y = 0;
+    e->madctl = 0x00;
+    e->colmod = 0x66;
+    e->tfa = 0;
+    e->vsa = H;
+    e->vsp = 0;
+    e->scrolling = false;
+    e->inverted = false;
+    e->awake = false;
+    e->on = false;
+}
+
+/* Memory cell under the cursor, NULL outside the panel. Column/row
+ * addresses go through MADCTL: MV swaps them, MX and MY mirror them. The
+ * modules this driver targets are mounted so that MADCTL 0x48 (MX|BGR) is
+ * upright, so MX counts from the left. */
+static uint16_t *emu_cell(emu_t *e) {
+    int col = e->x, row = e->y;
+    bool mv = e->madctl & 0x20;
+
+    if (col >= (mv ? H : W) || row >= (mv ? W : H) || !e->mem) return NULL;
+    int px = mv ? row : col;
+    int py = mv ? col : row;
+    if (!(e->madctl & 0x40)) px = W - 1 - px;
+    if (e->madctl & 0x80) py = H - 1 - py;
+    return &e->mem[py * W + px];
+}
+
+// RGB order: red and blue trade places, both ways
+static uint16_t emu_color_order(const emu_t *e, uint16_t c) {
+    return (e->madctl & 0x08) ? c : (c & 0x07E0) | (c >> 11) | (c << 11);
+}
+
+/* Advance the cursor, wrapping inside the window like the panel does. */
+static void emu_advance(emu_t *e) {
+    if (++e->x > e->xe) {
+        e->x = e->xs;
+        if (++e->y > e->ye) e->y = e->ys;
+    }
+}
+
+static void emu_put_pixel(emu_t *e, uint16_t c) {
+    uint16_t *cell = emu_cell(e);
+    if (cell) *cell = emu_color_order(e, c);
+    emu_advance(e);
+}
+
+/* RAMRD/RAMRDC data, without the dummy byte: 18-bit pixels, each channel
+ * in the top six bits of a byte, the 5-bit ones widened like the panel
+ * does (MSB copied into the LSB). */
+static void emu_read_pixels(emu_t *e, uint8_t *out, int len) {
+    for (int i = 0; i < len; i += 3) {
+        uint16_t *cell = emu_cell(e);
+        uint16_t c = cell ? emu_color_order(e, *cell) : 0;
+        uint8_t r = c >> 11, g = (c >> 5) & 0x3F, b = c & 0x1F;
+        uint8_t px[3] = {
+            (uint8_t)(((r << 1) | (r >> 4)) << 2),
+            (uint8_t)(g << 2),
+            (uint8_t)(((b << 1) | (b >> 4)) << 2),
+        };
+        memcpy(out + i, px, len - i < 3 ? len - i : 3);
+        emu_advance(e);
+    }
+}
+
+static void emu_command(emu_t *e, uint8_t cmd) {
+    e->cmd = cmd;
+    e->nparam = 0;
+    e->npx = 0;
+
+    switch (cmd) {
+    case 0x01: emu_regs_reset(e); break;                    // SWRESET
+    case 0x10: e->awake = false; break;                    // SLPIN
+    case 0x11: e->awake = true; break;                     // SLPOUT
+    case 0x13: e->scrolling = false; break;                // NORON
+    case 0x20: e->inverted = false; break;                 // INVOFF
+    case 0x21: e->inverted = true; break;                  // INVON
+    case 0x28: e->on = false; break;                       // DISPOFF
+    case 0x29: e->on = true; break;                        // DISPON
+    case 0x2C: e->x = e->xs; e->y = e->ys; break;       // RAMWR
+    default: break;
+    }
+}
+
+/* A parameter byte; registers are latched once all their bytes arrived. */
+static void emu_param(emu_t *e, uint8_t b) {
+    if (e->nparam < (int)sizeof(e->param)) {
+        e->param[e->nparam] = b;
+    }
+    int n = ++e->nparam;
+    const uint8_t *p = e->param;
+
+    switch (e->cmd) {
+    case 0x2A:                                              // CASET
+        if (n == 4) {
+            e->xs = (p[0] << 8) | p[1];
+            e->xe = (p[2] << 8) | p[3];
+        }
+        break;
+    case 0x2B:                                              // RASET
+        if (n == 4) {
+            e->ys = (p[0] << 8) | p[1];
+            e->ye = (p[2] << 8) | p[3];
+        }
+        break;
+    case 0x33:                                              // VSCRDEF
+        if (n == 6) {
+            e->tfa = (p[0] << 8) | p[1];
+            e->vsa = (p[2] << 8) | p[3];
+        }
+        break;
+    case 0x37:                                              // VSCRSADD
+        if (n == 2) {
+            e->vsp = (p[0] << 8) | p[1];
+            e->scrolling = true;
+        }
+        break;
+    case 0x36: if (n == 1) e->madctl = b; break;           // MADCTL
+    case 0x3A: if (n == 1) e->colmod = b; break;           // COLMOD
+    default: break;
+    }
+}
+
+/* Pixel bytes after RAMWR/RAMWRC: 16-bit RGB565 high byte first, or 18-bit
+ * as three bytes with the color in the top six bits of each. */
+static void emu_pixels(emu_t *e, const uint8_t *d, uint32_t len) {
+    bool rgb666 = (e->colmod & 0x07) == 0x06;
+    int bpp = rgb666 ? 3 : 2;
+
+    for (uint32_t i = 0; i < len; i++) {
+        e->px[e->npx++] = d[i];
+        if (e->npx < bpp) continue;
+        e->npx = 0;
+        if (rgb666) {
+            emu_put_pixel(e, ((e->px[0] >> 3) << 11) | ((e->px[1] >> 2) << 5) | (e->px[2] >> 3));
+        } else {
+            emu_put_pixel(e, (e->px[0] << 8) | e->px[1]);
+        }
+    }
+}
+
+/* One emulated panel per display, each with its own memory. */
+static emu_t *emu_get(void **dev) {
+    if (!*dev) {
+        *dev = calloc(1, sizeof(emu_t));
+    }
+    emu_t *e = *dev;
+    if (e && !e->mem) {
+        e->mem = calloc(W * H, sizeof(uint16_t));
+        emu_regs_reset(e);
+    }
+    return e;
+}
+
+static void bus_host_reset(void **dev, const display_config_t *cfg) {
+    emu_t *e = emu_get(dev);
+    if (!e || !e->mem) return;
+    memset(e->mem, 0, W * H * sizeof(uint16_t));
+    emu_regs_reset(e);
+}
+
+static esp_err_t bus_host_init(void **dev, const display_config_t *cfg) {
+    emu_t *e = emu_get(dev);
+    return e && e->mem ? ESP_OK : ESP_ERR_NO_MEM;
+}
+
+// Memory the DMA can't read, see display_host_set_external()
+static const uint8_t *ext_start;
+static size_t ext_len;
+
+void display_host_set_external(const void *start, size_t len) {
+    ext_start = start;
+    ext_len = len;
+}
+
+bool display_host_dma_capable(const void *p) {
+    const uint8_t *b = p;
+    return !ext_len || b < ext_start || b >= ext_start + ext_len;
+}
+
+static void emu_transfer(emu_t *e, uint8_t dc, const uint8_t *d, uint32_t len) {
+    if (dc == 0) {
+        for (uint32_t i = 0; i < len; i++) {
+            emu_command(e, d[i]);
+        }
+    } else if (e->cmd == 0x2C || e->cmd == 0x3C) {
+        emu_pixels(e, d, len);
+    } else {
+        for (uint32_t i = 0; i < len; i++) {
+            emu_param(e, d[i]);
+        }
+    }
+}
+
+static void bus_host_queue(void *dev, display_xfer_t *x) {
+    emu_t *e = dev;
+    const uint8_t *d = x->tx ? x->tx : x->data;
+
+    if (display_host_dma_capable(d)) {
+        emu_transfer(e, x->dc, d, x->len);
+    } else {
+        static const uint8_t junk[64] = {[0 ... 63] = 0xFF};
+        for (uint32_t i = 0; i < x->len; i += sizeof(junk)) {
+            uint32_t n = x->len - i < sizeof(junk) ? x->len - i : sizeof(junk);
+            emu_transfer(e, x->dc, junk, n);
+        }
+    }
+
+    e->pending++;
+    if (x->done_cb) {
+        x->done_cb(x->done_arg);
+    }
+}
+
+static void bus_host_reap(void *dev) {
+    emu_t *e = dev;
+    e->pending--;
+}
+
+static esp_err_t bus_host_set_clock(void *dev, int clock_hz) {
+    return ESP_OK;
+}
+
+/* The read commands the driver uses. Values come back with the dummy bits
+ * already stripped, as from the SPI backend. */
+static esp_err_t bus_host_read(void *dev, uint8_t cmd, uint8_t *out, int len, int dummy_bits) {
+    emu_t *e = dev;
+    uint8_t r[4] = {0};
+
+    switch (cmd) {
+    case 0x2E:                                  // RAMRD, from the window start
+        e->x = e->xs;
+        e->y = e->ys;
+        // fall through
+    case 0x3E:                                  // RAMRDC, where the last read stopped
+        e->cmd = cmd;
+        emu_read_pixels(e, out, len);
+        return ESP_OK;
+    case 0x04:                                  // RDDID: zeros, like most modules
+        break;
+    case 0x09:                                  // RDDST: booster, MADCTL, pixel format, display on
+        r[0] = (e->awake ? 0x80 : 0) | ((e->madctl >> 1) & 0x7E);
+        r[1] = (e->colmod & 0x07) << 4;
+        r[2] = e->on ? 0x04 : 0;
+        break;
+    case 0x0A:                                  // RDDPM
+        r[0] = (e->awake ? 0x90 : 0) | (e->scrolling ? 0 : 0x08) | (e->on ? 0x04 : 0);
+        break;
+    case 0x0B:                                  // RDDMADCTL
+        r[0] = e->madctl;
+        break;
+    case 0x0C:                                  // RDDCOLMOD
+        r[0] = e->colmod;
+        break;
+    default:
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+
+    memcpy(out, r, len < 4 ? len : 4);
+    return ESP_OK;
+}
+
+static esp_err_t bus_host_te_attach(void *dev, display_done_cb_t isr, void *arg) {
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+const display_bus_t display_bus_host = {
+    .name = "host",
+    .reset = bus_host_reset,
+    .init = bus_host_init,
+    .queue = bus_host_queue,
+    .reap = bus_host_reap,
+    .set_clock = bus_host_set_clock,
+    .read = bus_host_read,
+    .te_attach = bus_host_te_attach,
+};
+
+/* Panel memory row shown on screen row y: inside the scroll area the rows
+ * start at VSP and wrap within it. */
+static int emu_shown_row(const emu_t *e, int y) {
+    if (!e->scrolling || e->vsa == 0 || y < e->tfa || y >= e->tfa + e->vsa) {
+        return y;
+    }
+    int ofs = ((int)e->vsp - e->tfa) % e->vsa;
+    if (ofs < 0) ofs += e->vsa;
+    return e->tfa + (y - e->tfa + ofs) % e->vsa;
+}
+
+/* The emulator behind the selected display, NULL if it has none. Checks
+ * init rather than the bus itself, so wrappers around this backend count. */
+static const emu_t *emu_selected(void) {
+    if (display_bus()->init != bus_host_init) return NULL;
+    const emu_t *e = display_bus_dev();
+    return e && e->mem ? e : NULL;
+}
+
+static uint16_t emu_pixel(const emu_t *e, int x, int y) {
+    uint16_t c = e->mem[emu_shown_row(e, y) * W + x];
+    return e->inverted ? ~c : c;
+}
+
+uint16_t display_host_pixel(int x, int y) {
+    const emu_t *e = emu_selected();
+    if (!e || x < 0 || x >= W || y < 0 || y >= H) return 0;
+    return emu_pixel(e, x, y);
+}
+
+esp_err_t display_host_snapshot(uint16_t *out) {
+    const emu_t *e = emu_selected();
+    if (!e) return ESP_ERR_INVALID_STATE;
+    for (int y = 0; y < H; y++) {
+        for (int x = 0; x < W; x++) {
+            *out++ = emu_pixel(e, x, y);
+        }
+    }
+    return ESP_OK;
+}
+
+/* Binary PPM (P6), each channel widened to eight bits. */
+esp_err_t display_host_write_ppm(FILE *f) {
+    const emu_t *e = emu_selected();
+    uint8_t line[W * 3];
+
+    if (!e) return ESP_ERR_INVALID_STATE;
+    fprintf(f, "P6\n%d %d\n255\n", W, H);
+    for (int y = 0; y < H; y++) {
+        for (int x = 0; x < W; x++) {
+            uint16_t c = emu_pixel(e, x, y);
+            uint8_t r = c >> 11, g = (c >> 5) & 0x3F, b = c & 0x1F;
+            line[x * 3 + 0] = (r << 3) | (r >> 2);
+            line[x * 3 + 1] = (g << 2) | (g >> 4);
+            line[x * 3 + 2] = (b << 3) | (b >> 2);
+        }
+        if (fwrite(line, 1, sizeof(line), f) != sizeof(line)) return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+esp_err_t display_host_dump_ppm(const char *path) {
+    FILE *f = fopen(path, "wb");
+    if (!f) return ESP_FAIL;
+    esp_err_t ret = display_host_write_ppm(f);
+    if (fclose(f) != 0 && ret == ESP_OK) ret = ESP_FAIL;
+    return ret;
+}
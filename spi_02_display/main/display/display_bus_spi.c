@@ -0,0 +1,258 @@
+#include "display.h"
+#include "display_bus.h"
+#include "driver/gpio.h"
+#include "driver/spi_master.h"
+#include "freertos/task.h"
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include <string.h>
+
+// ESP32 SPI master backend: transfers are queued to the driver as DMA
+// transactions, and DC is driven per transaction from spi_pre_cb. Each
+// panel is a device of its own on the host, so several can share it.
+
+// A driver transaction plus what spi_pre_cb needs to set DC for it
+typedef struct {
+    spi_transaction_t t;
+    const display_xfer_t *x;
+    int pin_dc;
+} spi_slot_t;
+
+typedef struct {
+    spi_device_handle_t spi;
+    const display_config_t *cfg;
+    // One slot per in-flight transfer; the core never has more than
+    // DISPLAY_BUS_DEPTH queued, so slots are reused in queue order.
+    spi_slot_t ring[DISPLAY_BUS_DEPTH];
+    uint32_t next;
+} spi_panel_t;
+
+// Transactions are read by the driver's ISR, so keep them internal
+static spi_panel_t *panel_get(void **dev, const display_config_t *cfg) {
+    if (!*dev) {
+        *dev = heap_caps_calloc(1, sizeof(spi_panel_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    }
+    spi_panel_t *p = *dev;
+    if (p) p->cfg = cfg;
+    return p;
+}
+
+static void bus_spi_reset(void **dev, const display_config_t *cfg) {
+    gpio_set_direction(cfg->pin_dc, GPIO_MODE_OUTPUT);
+    if (cfg->pin_led >= 0) {
+        gpio_set_direction(cfg->pin_led, GPIO_MODE_OUTPUT);
+        gpio_set_level(cfg->pin_led, 1);
+    }
+    if (cfg->pin_rst < 0) return;   // tied to another panel's reset or to EN
+
+    gpio_set_direction(cfg->pin_rst, GPIO_MODE_OUTPUT);
+    gpio_set_level(cfg->pin_rst, 0);
+    vTaskDelay(pdMS_TO_TICKS(100));
+    gpio_set_level(cfg->pin_rst, 1);
+    vTaskDelay(pdMS_TO_TICKS(100));
+}
+
+// Runs in ISR context right before each transaction starts and drives DC
+// from the transfer itself, so command and data transactions can sit
+// back-to-back in the queue without the CPU touching the pin in between.
+static void IRAM_ATTR spi_pre_cb(spi_transaction_t *t) {
+    const spi_slot_t *s = t->user;
+    gpio_set_level(s->pin_dc, s->x ? s->x->dc : 1);
+}
+
+// Runs in ISR context after every transaction on a panel device.
+static void IRAM_ATTR spi_post_cb(spi_transaction_t *t) {
+    const spi_slot_t *s = t->user;
+    if (s->x && s->x->done_cb) {
+        s->x->done_cb(s->x->done_arg);
+    }
+}
+
+/* (Re)attach the panel to the bus at the given clock. Above the read clock
+ * the dummy-cycle check is skipped: MISO is only sampled at READ_CLOCK_HZ,
+ * and without the flag the driver refuses full-duplex devices past ~26 MHz
+ * on GPIO-matrix pins. */
+static esp_err_t spi_add_panel(spi_panel_t *p, int clock_hz) {
+    spi_device_interface_config_t spi_device_config = {
+        .clock_speed_hz = clock_hz,
+        .mode = 0,
+        .spics_io_num = p->cfg->pin_cs,
+        .queue_size = DISPLAY_BUS_DEPTH,
+        .flags = (clock_hz > READ_CLOCK_HZ) ? SPI_DEVICE_NO_DUMMY : 0,
+        .pre_cb = spi_pre_cb,
+        .post_cb = spi_post_cb,
+    };
+
+    return spi_bus_add_device(p->cfg->host, &spi_device_config, &p->spi);
+}
+
+/* The first panel on a host initializes the bus with its pins; later ones
+ * (and a flash set up elsewhere) find it busy and just add their device. */
+static esp_err_t bus_spi_init(void **dev, const display_config_t *cfg) {
+    spi_panel_t *p = panel_get(dev, cfg);
+    if (!p) return ESP_ERR_NO_MEM;
+
+    spi_bus_config_t spi_config = {
+        .mosi_io_num = cfg->pin_mosi,
+        .miso_io_num = cfg->pin_miso,
+        .sclk_io_num = cfg->pin_clk,
+        .quadwp_io_num = -1,
+        .quadhd_io_num = -1,
+        .max_transfer_sz = cfg->max_transfer_sz
+    };
+
+    esp_err_t ret = spi_bus_initialize(cfg->host, &spi_config, SPI_DMA_CH_AUTO);
+    if (ret == ESP_OK || ret == ESP_ERR_INVALID_STATE) {
+        ret = spi_add_panel(p, cfg->clock_speed_hz);
+    }
+    if (ret != ESP_OK) {
+        heap_caps_free(p);
+        *dev = NULL;
+    }
+    return ret;
+}
+
+/* Parameters of four bytes or less travel inside the transaction itself. */
+static void bus_spi_queue(void *dev, display_xfer_t *x) {
+    spi_panel_t *p = dev;
+    spi_slot_t *s = &p->ring[p->next++ % DISPLAY_BUS_DEPTH];
+    spi_transaction_t *t = &s->t;
+    memset(t, 0, sizeof(*t));
+    s->x = x;
+    s->pin_dc = p->cfg->pin_dc;
+    t->length = x->len * 8;
+    t->user = s;
+    if (x->tx) {
+        t->tx_buffer = x->tx;
+    } else {
+        t->flags = SPI_TRANS_USE_TXDATA;
+        memcpy(t->tx_data, x->data, x->len);
+    }
+    spi_device_queue_trans(p->spi, t, portMAX_DELAY);
+}
+
+static void bus_spi_reap(void *dev) {
+    spi_panel_t *p = dev;
+    spi_transaction_t *rt;
+    spi_device_get_trans_result(p->spi, &rt, portMAX_DELAY);
+}
+
+static esp_err_t bus_spi_set_clock(void *dev, int clock_hz) {
+    spi_panel_t *p = dev;
+    spi_bus_remove_device(p->spi);
+    return spi_add_panel(p, clock_hz);
+}
+
+/* Register reads with a few dummy bits clock in one extra byte and shift
+ * the result back into place. Whole dummy bytes (RAMRD) are clocked out
+ * and dropped instead, and the data then goes straight to out, in pieces
+ * of at most max_transfer_sz with CS held low throughout. */
+static esp_err_t bus_spi_read(void *dev, uint8_t cmd, uint8_t *out, int len, int dummy_bits) {
+    spi_panel_t *p = dev;
+    uint8_t rx[8] = {0};
+    int shift = dummy_bits % 8;
+
+    if (p->cfg->pin_miso < 0) return ESP_ERR_NOT_SUPPORTED;
+    if (len <= 0 || (shift && len > (int)sizeof(rx) - 1)) return ESP_ERR_INVALID_SIZE;
+    if (dummy_bits / 8 > (int)sizeof(rx)) return ESP_ERR_INVALID_ARG;
+
+    spi_device_acquire_bus(p->spi, portMAX_DELAY);
+
+    display_xfer_t cx = {.dc = 0}, dx = {.dc = 1};
+    spi_slot_t cs = {.x = &cx, .pin_dc = p->cfg->pin_dc};
+    spi_slot_t ds = {.x = &dx, .pin_dc = p->cfg->pin_dc};
+    spi_transaction_t c = {
+        .flags = SPI_TRANS_USE_TXDATA | SPI_TRANS_CS_KEEP_ACTIVE,
+        .length = 8,
+        .tx_data = {cmd},
+        .user = &cs,
+    };
+    spi_device_polling_transmit(p->spi, &c);
+
+    if (shift) {
+        spi_transaction_t d = {
+            .length = (len + 1) * 8,
+            .rxlength = (len + 1) * 8,
+            .rx_buffer = rx,
+            .user = &ds,
+        };
+        spi_device_polling_transmit(p->spi, &d);
+        for (int i = 0; i < len; i++) {
+            out[i] = (rx[i] << shift) | (rx[i + 1] >> (8 - shift));
+        }
+    } else {
+        int skip = dummy_bits / 8;
+        if (skip) {
+            spi_transaction_t d = {
+                .flags = SPI_TRANS_CS_KEEP_ACTIVE,
+                .length = skip * 8,
+                .rxlength = skip * 8,
+                .rx_buffer = rx,
+                .user = &ds,
+            };
+            spi_device_polling_transmit(p->spi, &d);
+        }
+        for (int offset = 0; offset < len; offset += p->cfg->max_transfer_sz) {
+            int n = (len - offset > p->cfg->max_transfer_sz) ? p->cfg->max_transfer_sz : len - offset;
+            spi_transaction_t d = {
+                .flags = (offset + n < len) ? SPI_TRANS_CS_KEEP_ACTIVE : 0,
+                .length = n * 8,
+                .rxlength = n * 8,
+                .rx_buffer = out + offset,
+                .user = &ds,
+            };
+            spi_device_polling_transmit(p->spi, &d);
+        }
+    }
+
+    spi_device_release_bus(p->spi);
+    return ESP_OK;
+}
+
+/* While a panel holds the bus, the driver keeps every other device's
+ * queued transactions (and the flash) waiting. */
+static esp_err_t bus_spi_acquire(void *dev) {
+    spi_panel_t *p = dev;
+    return spi_device_acquire_bus(p->spi, portMAX_DELAY);
+}
+
+static void bus_spi_release(void *dev) {
+    spi_panel_t *p = dev;
+    spi_device_release_bus(p->spi);
+}
+
+static esp_err_t bus_spi_te_attach(void *dev, display_done_cb_t isr, void *arg) {
+    const display_config_t *cfg = ((spi_panel_t *)dev)->cfg;
+    if (cfg->pin_te < 0) return ESP_ERR_NOT_SUPPORTED;
+
+    if (!isr) {
+        return gpio_isr_handler_remove(cfg->pin_te);
+    }
+
+    gpio_config_t io = {
+        .pin_bit_mask = 1ULL << cfg->pin_te,
+        .mode = GPIO_MODE_INPUT,
+        .pull_up_en = GPIO_PULLUP_DISABLE,
+        .pull_down_en = GPIO_PULLDOWN_ENABLE,
+        .intr_type = GPIO_INTR_POSEDGE,
+    };
+    esp_err_t ret = gpio_config(&io);
+    if (ret != ESP_OK) return ret;
+
+    ret = gpio_install_isr_service(0);
+    if (ret != ESP_OK && ret != ESP_ERR_INVALID_STATE) return ret;   // already installed is fine
+    return gpio_isr_handler_add(cfg->pin_te, isr, arg);
+}
+
+const display_bus_t display_bus_spi = {
+    .name = "spi",
+    .reset = bus_spi_reset,
+    .init = bus_spi_init,
+    .queue = bus_spi_queue,
+    .reap = bus_spi_reap,
+    .set_clock = bus_spi_set_clock,
+    .read = bus_spi_read,
+    .acquire = bus_spi_acquire,
+    .release = bus_spi_release,
+    .te_attach = bus_spi_te_attach,
+};
@@ -0,0 +1,84 @@
+#include "display_dirty.h"
+
+// Merging is worth it as long as the extra pixels sent cost less than a
+// separate CASET/RASET/RAMWR window (roughly a few hundred pixels of bus time).
+#define DIRTY_MERGE_SLACK 256
+
+static uint32_t rect_area(const display_rect_t *r) {
+    return (uint32_t)(r->x1 - r->x0 + 1) * (r->y1 - r->y0 + 1);
+}
+
+static display_rect_t rect_union(const display_rect_t *a, const display_rect_t *b) {
+    display_rect_t u = {
+        .x0 = a->x0 < b->x0 ? a->x0 : b->x0,
+        .y0 = a->y0 < b->y0 ? a->y0 : b->y0,
+        .x1 = a->x1 > b->x1 ? a->x1 : b->x1,
+        .y1 = a->y1 > b->y1 ? a->y1 : b->y1,
+    };
+    return u;
+}
+
+static uint32_t rect_overlap(const display_rect_t *a, const display_rect_t *b) {
+    int x0 = a->x0 > b->x0 ? a->x0 : b->x0;
+    int y0 = a->y0 > b->y0 ? a->y0 : b->y0;
+    int x1 = a->x1 < b->x1 ? a->x1 : b->x1;
+    int y1 = a->y1 < b->y1 ? a->y1 : b->y1;
+    if (x1 < x0 || y1 < y0) return 0;
+    return (uint32_t)(x1 - x0 + 1) * (y1 - y0 + 1);
+}
+
+/* Pixels that would be sent needlessly if a and b were flushed as one window. */
+static uint32_t merge_waste(const display_rect_t *a, const display_rect_t *b) {
+    display_rect_t u = rect_union(a, b);
+    uint32_t covered = rect_area(a) + rect_area(b) - rect_overlap(a, b);
+    return rect_area(&u) - covered;
+}
+
+static void remove_at(display_dirty_t *d, int i) {
+    d->rects[i] = d->rects[--d->count];
+}
+
+void display_dirty_reset(display_dirty_t *d) {
+    d->count = 0;
+}
+
+void display_dirty_add(display_dirty_t *d, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+    if (x1 < x0 || y1 < y0) return;
+    display_rect_t r = { x0, y0, x1, y1 };
+
+    // Absorb every rectangle that merges cheaply; growing r may enable more
+    for (int i = 0; i < d->count; ) {
+        if (merge_waste(&d->rects[i], &r) <= DIRTY_MERGE_SLACK) {
+            r = rect_union(&d->rects[i], &r);
+            remove_at(d, i);
+            i = 0;
+        } else {
+            i++;
+        }
+    }
+
+    // List full: fold r into the rectangle it wastes the least with
+    while (d->count == DISPLAY_DIRTY_MAX) {
+        int best = 0;
+        uint32_t best_waste = UINT32_MAX;
+        for (int i = 0; i < d->count; i++) {
+            uint32_t w = merge_waste(&d->rects[i], &r);
+            if (w < best_waste) {
+                best_waste = w;
+                best = i;
+            }
+        }
+        r = rect_union(&d->rects[best], &r);
+        remove_at(d, best);
+    }
+
+    d->rects[d->count++] = r;
+}
+
+uint32_t display_dirty_area(const display_dirty_t *d) {
+    uint32_t area = 0;
+    for (int i = 0; i < d->count; i++) {
+        area += rect_area(&d->rects[i]);
+    }
+    return area;
+}
@@ -0,0 +1,28 @@
+#ifndef DISPLAY_DIRTY_H
+#define DISPLAY_DIRTY_H
+
+#include <stdint.h>
+
+/*
+ * Dirty-region tracker: a short list of rectangles that covers every pixel
+ * touched since the last reset. Overlapping or nearly touching rectangles
+ * are merged as they are added, so flushing the list needs few windows.
+ */
+
+#define DISPLAY_DIRTY_MAX 16
+
+// Inclusive pixel coordinates, same convention as set_window()
+typedef struct {
+    uint16_t x0, y0, x1, y1;
+} display_rect_t;
+
+typedef struct {
+    display_rect_t rects[DISPLAY_DIRTY_MAX];
+    int count;
+} display_dirty_t;
+
+void display_dirty_reset(display_dirty_t *d);
+void display_dirty_add(display_dirty_t *d, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+uint32_t display_dirty_area(const display_dirty_t *d);
+
+#endif
@@ -0,0 +1,243 @@
+#include "display_fb.h"
+#include "display.h"
+#include "display_priv.h"
+#include "display_dirty.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_heap_caps.h"
+#include <string.h>
+
+#define FB_PIXELS (DISPLAY_PANEL_WIDTH * DISPLAY_PANEL_HEIGHT)
+
+static uint16_t *fb[2];
+static int back_idx;
+static TaskHandle_t flush_task;
+static SemaphoreHandle_t flush_idle;   // given while no flush is running
+static display_dirty_t back_dirty;     // changed since the last present
+static display_dirty_t flush_dirty;    // being streamed by the flush task
+#if CONFIG_DISPLAY_FB_PSRAM
+static display_pingpong_t flush_bounce; // internal DMA buffers the frames go out through
+#endif
+
+#if CONFIG_DISPLAY_FB_PSRAM
+/* The DMA can't read PSRAM: as many rows of the window as fit are packed
+ * into a bounce buffer (the panel wraps them inside the window), so even a
+ * narrow window goes out in large transfers, and the next buffer is copied
+ * while the previous one is on the wire. */
+static void fb_flush_rect(const uint16_t *front, const display_rect_t *r) {
+    int stride = display_width();
+    int w = r->x1 - r->x0 + 1;
+    int rows_per_buf = flush_bounce.size / (w * 2);
+    set_window(r->x0, r->y0, r->x1, r->y1);
+    for (int y = r->y0; y <= r->y1; y += rows_per_buf) {
+        int rows = (r->y1 + 1 - y < rows_per_buf) ? r->y1 + 1 - y : rows_per_buf;
+        uint16_t *dst = (uint16_t *)display_pp_next(&flush_bounce);
+        for (int i = 0; i < rows; i++) {
+            memcpy(dst + i * w, front + (y + i) * stride + r->x0, w * sizeof(uint16_t));
+        }
+        display_pp_submit(&flush_bounce, rows * w * 2);
+    }
+}
+#else
+/* Send one dirty window out of the front buffer. Full-width rectangles are
+ * contiguous in memory; anything narrower goes out row by row. */
+static void fb_flush_rect(const uint16_t *front, const display_rect_t *r) {
+    int stride = display_width();
+    int w = r->x1 - r->x0 + 1;
+    set_window(r->x0, r->y0, r->x1, r->y1);
+    if (w == stride) {
+        display_queue_data(front + r->y0 * stride, w * (r->y1 - r->y0 + 1) * 2, NULL, NULL);
+        return;
+    }
+    for (int y = r->y0; y <= r->y1; y++) {
+        display_queue_data(front + y * stride + r->x0, w * 2, NULL, NULL);
+    }
+}
+#endif
+
+static void fb_flush_task(void *arg) {
+    display_select(arg);
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (display_te_enabled()) {
+            // Start on V-blank so the write leads the refresh scan down the panel
+            display_wait_vsync(pdMS_TO_TICKS(50));
+        }
+        const uint16_t *front = fb[back_idx ^ 1];
+        for (int i = 0; i < flush_dirty.count; i++) {
+            fb_flush_rect(front, &flush_dirty.rects[i]);
+        }
+        display_wait_done();
+        xSemaphoreGive(flush_idle);
+    }
+}
+
+/* Bring the rectangles of the frame just presented into the new back buffer. */
+static void fb_sync_back(const display_dirty_t *d) {
+    uint16_t *dst = fb[back_idx];
+    const uint16_t *src = fb[back_idx ^ 1];
+    int stride = display_width();
+    for (int i = 0; i < d->count; i++) {
+        const display_rect_t *r = &d->rects[i];
+        int w = r->x1 - r->x0 + 1;
+        for (int y = r->y0; y <= r->y1; y++) {
+            int off = y * stride + r->x0;
+            memcpy(dst + off, src + off, w * sizeof(uint16_t));
+        }
+    }
+}
+
+esp_err_t display_fb_init(void) {
+    if (fb[0]) return ESP_OK;
+
+    for (int i = 0; i < 2; i++) {
+#if CONFIG_DISPLAY_FB_PSRAM
+        fb[i] = heap_caps_malloc(FB_PIXELS * sizeof(uint16_t), MALLOC_CAP_SPIRAM);
+#else
+        fb[i] = heap_caps_malloc(FB_PIXELS * sizeof(uint16_t), MALLOC_CAP_DMA);
+#endif
+        if (!fb[i]) {
+            display_fb_deinit();
+            return ESP_ERR_NO_MEM;
+        }
+        memset(fb[i], 0, FB_PIXELS * sizeof(uint16_t));
+    }
+#if CONFIG_DISPLAY_FB_PSRAM
+    // A full-width row must fit, so a bounce buffer never holds less than one
+    int bounce_size = display_get_config()->max_transfer_sz;
+    if (bounce_size < DISPLAY_PANEL_HEIGHT * 2) bounce_size = DISPLAY_PANEL_HEIGHT * 2;
+    if (display_pp_init(&flush_bounce, bounce_size) != ESP_OK) {
+        display_fb_deinit();
+        return ESP_ERR_NO_MEM;
+    }
+#endif
+    back_idx = 0;
+    display_dirty_reset(&back_dirty);
+    display_dirty_add(&back_dirty, 0, 0, display_width() - 1, display_height() - 1);
+
+    flush_idle = xSemaphoreCreateBinary();
+    if (!flush_idle) {
+        display_fb_deinit();
+        return ESP_ERR_NO_MEM;
+    }
+    xSemaphoreGive(flush_idle);
+
+    // The flush task sends to the display selected here
+    if (xTaskCreate(fb_flush_task, "disp_flush", 2048, display_selected(), 5, &flush_task) != pdPASS) {
+        display_fb_deinit();
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+void display_fb_deinit(void) {
+    if (flush_task) {
+        display_fb_wait_idle();
+        vTaskDelete(flush_task);
+        flush_task = NULL;
+    }
+    if (flush_idle) {
+        vSemaphoreDelete(flush_idle);
+        flush_idle = NULL;
+    }
+#if CONFIG_DISPLAY_FB_PSRAM
+    display_pp_free(&flush_bounce);
+#endif
+    for (int i = 0; i < 2; i++) {
+        heap_caps_free(fb[i]);
+        fb[i] = NULL;
+    }
+}
+
+uint16_t *display_fb_back(void) {
+    return fb[back_idx];
+}
+
+void display_fb_clear(uint16_t color) {
+    display_fb_fill_rect(0, 0, display_width() - 1, display_height() - 1, color);
+}
+
+void display_fb_fill_rect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color) {
+    if (x1 >= display_width()) x1 = display_width() - 1;
+    if (y1 >= display_height()) y1 = display_height() - 1;
+    if (x1 < x0 || y1 < y0) return;
+
+    display_dirty_add(&back_dirty, x0, y0, x1, y1);
+    // Fill the first row, then copy it down
+    uint16_t c = DISPLAY_SWAP16(color);
+    int w = x1 - x0 + 1;
+    int stride = display_width();
+    uint16_t *first = fb[back_idx] + y0 * stride + x0;
+    for (int x = 0; x < w; x++) {
+        first[x] = c;
+    }
+    for (int y = y0 + 1; y <= y1; y++) {
+        memcpy(first + (y - y0) * stride, first, w * sizeof(uint16_t));
+    }
+}
+
+/* Same pixel layout as draw_image(): the words are copied as-is. */
+void display_fb_blit(uint16_t x0, uint16_t y0, uint16_t w, uint16_t h, const uint16_t *image_data) {
+    int stride = display_width(), rows = display_height();
+    if (x0 >= stride || y0 >= rows) return;
+    int cw = (x0 + w > stride) ? stride - x0 : w;
+    int ch = (y0 + h > rows) ? rows - y0 : h;
+
+    display_dirty_add(&back_dirty, x0, y0, x0 + cw - 1, y0 + ch - 1);
+    uint16_t *dst = fb[back_idx] + y0 * stride + x0;
+    for (int y = 0; y < ch; y++) {
+        memcpy(dst + y * stride, image_data + y * w, cw * sizeof(uint16_t));
+    }
+}
+
+void display_fb_blend_sprite(int x, int y, const display_alpha_sprite_t *sprite, uint8_t opacity) {
+    int x0 = x < 0 ? 0 : x;
+    int y0 = y < 0 ? 0 : y;
+    int x1 = x + sprite->width - 1;
+    int y1 = y + sprite->height - 1;
+    if (x1 >= display_width()) x1 = display_width() - 1;
+    if (y1 >= display_height()) y1 = display_height() - 1;
+    if (x1 < x0 || y1 < y0) return;
+
+    display_dirty_add(&back_dirty, x0, y0, x1, y1);
+    display_blend_sprite(sprite, x, y, opacity, fb[back_idx], 0, 0, display_width(), display_height());
+}
+
+void display_fb_draw_shape(const display_shape_t *shape) {
+    int x0, y0, x1, y1;
+    display_shape_bounds(shape, &x0, &y0, &x1, &y1);
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 >= display_width()) x1 = display_width() - 1;
+    if (y1 >= display_height()) y1 = display_height() - 1;
+    if (x1 < x0 || y1 < y0) return;
+
+    display_dirty_add(&back_dirty, x0, y0, x1, y1);
+    display_shape_render(shape, fb[back_idx], 0, 0, display_width(), display_height());
+}
+
+void display_fb_mark_dirty(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+    if (x1 >= display_width()) x1 = display_width() - 1;
+    if (y1 >= display_height()) y1 = display_height() - 1;
+    display_dirty_add(&back_dirty, x0, y0, x1, y1);
+}
+
+/* Swap buffers and stream only the windows that changed. The new back buffer
+ * gets those same windows copied in, so callers may keep drawing
+ * incrementally. Nothing is sent when the frame is unchanged. */
+void display_present(void) {
+    if (back_dirty.count == 0) return;
+
+    xSemaphoreTake(flush_idle, portMAX_DELAY);
+    back_idx ^= 1;
+    flush_dirty = back_dirty;
+    display_dirty_reset(&back_dirty);
+    xTaskNotifyGive(flush_task);
+    fb_sync_back(&flush_dirty);
+}
+
+void display_fb_wait_idle(void) {
+    xSemaphoreTake(flush_idle, portMAX_DELAY);
+    xSemaphoreGive(flush_idle);
+}
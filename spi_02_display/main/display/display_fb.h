@@ -0,0 +1,43 @@
+#ifndef DISPLAY_FB_H
+#define DISPLAY_FB_H
+
+#include "esp_err.h"
+#include "display_blend.h"
+#include "display_shape.h"
+#include <stdint.h>
+
+/*
+ * Optional double-buffered framebuffer.
+ *
+ * The application renders into the back buffer while a flush task streams
+ * the front buffer to the panel. display_present() hands the back buffer
+ * over and returns as soon as the previous flush has finished.
+ *
+ * Only regions that changed since the last present are sent: the drawing
+ * helpers record them automatically, and code that writes through
+ * display_fb_back() directly must report them with display_fb_mark_dirty().
+ *
+ * Two 240x320 RGB565 frames take 300 KB of DMA-capable RAM, or of PSRAM
+ * with CONFIG_DISPLAY_FB_PSRAM; flushes then stream through two internal
+ * bounce buffers of max_transfer_sz bytes. While the framebuffer is
+ * active, the flush task owns the bus: do not mix it with direct
+ * clear_screen()/draw_image() calls.
+ */
+
+esp_err_t display_fb_init(void);
+void display_fb_deinit(void);
+
+// Back buffer, row-major 240x320, pixels stored in panel (big-endian) order
+uint16_t *display_fb_back(void);
+
+void display_fb_clear(uint16_t color);
+void display_fb_fill_rect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
+void display_fb_blit(uint16_t x0, uint16_t y0, uint16_t w, uint16_t h, const uint16_t *image_data);
+void display_fb_blend_sprite(int x, int y, const display_alpha_sprite_t *sprite, uint8_t opacity);
+void display_fb_draw_shape(const display_shape_t *shape);
+void display_fb_mark_dirty(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+
+void display_present(void);
+void display_fb_wait_idle(void);
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef DISPLAY_FONT_H
+#define DISPLAY_FONT_H
+
+#include "esp_err.h"
+#include <stdint.h>
+
+/*
+ * Anti-aliased bitmap fonts generated by tools/font2atlas.py.
+ *
+ * Every glyph is cropped to its ink box and stored as 4-bit coverage, two
+ * pixels per byte (high nibble first), rows padded to whole bytes. Glyphs
+ * in use are kept run-length encoded in a small RAM cache, and draw_text()
+ * composes a whole string into one DMA band sent through a single window.
+ */
+
+typedef struct {
+    uint16_t offset;        // into the font bitmap
+    uint8_t width;
+    uint8_t height;
+    int8_t x_ofs;           // ink box relative to the pen position
+    int8_t y_ofs;           // and to the top of the line
+    uint8_t advance;
+} display_glyph_t;
+
+typedef struct {
+    const uint8_t *bitmap;
+    const display_glyph_t *glyphs;
+    uint16_t first;         // code point of glyphs[0]
+    uint16_t count;
+    uint8_t line_height;
+    uint8_t baseline;
+} display_font_t;
+
+extern const display_font_t display_font_dejavu_mono_16;
+
+int display_text_width(const display_font_t *font, const char *str);
+
+// Colors of the 16 coverage levels of fg over bg, in panel byte order
+void display_text_ramp(uint16_t ramp[16], uint16_t fg, uint16_t bg);
+
+// Compose str with its line top-left at (x, y) into a panel-order pixel
+// buffer covering the screen rectangle (buf_x, buf_y, buf_w x buf_h).
+// Pixels outside the buffer are clipped; untouched pixels keep their value.
+// With a ramp, coverage maps straight to its colors; with ramp == NULL, fg
+// is blended over the pixels already in the buffer.
+void display_text_render(const display_font_t *font, const char *str, int x, int y,
+                         uint16_t fg, const uint16_t ramp[16], uint16_t *buf,
+                         int buf_x, int buf_y, int buf_w, int buf_h);
+
+// Draw one line of text on a solid background. Returns once the band is
+// queued; the text is clipped at the right edge of the panel.
+esp_err_t draw_text(uint16_t x, uint16_t y, const char *str, const display_font_t *font,
+                    uint16_t fg, uint16_t bg);
+
+#endif
@@ -0,0 +1,35 @@
+#ifndef DISPLAY_HOST_H
+#define DISPLAY_HOST_H
+
+// ILI9341 emulator behind display_bus_host. The command stream is decoded
+// into panel memory (CASET/RASET/RAMWR/RAMWRC, MADCTL, COLMOD, scrolling,
+// inversion) and RAMRD reads it back, so the whole stack runs without a
+// panel: golden-image tests and rendering benchmarks on the linux target.
+//
+// Each display on this backend is a panel of its own. Everything below
+// reads the selected display's screen as the panel would show it, in its
+// native 240x320 portrait scan: MADCTL, the scroll offset and inversion are
+// applied. Pixels are RGB565 in CPU byte order. Call display_wait_done()
+// first if queued transfers should be included.
+
+#include "esp_err.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define DISPLAY_HOST_WIDTH  240
+#define DISPLAY_HOST_HEIGHT 320
+
+uint16_t display_host_pixel(int x, int y);
+esp_err_t display_host_snapshot(uint16_t *out);     // WIDTH * HEIGHT pixels
+esp_err_t display_host_write_ppm(FILE *f);
+esp_err_t display_host_dump_ppm(const char *path);
+
+// Make [start, start + len) memory the emulated DMA can't read, as PSRAM
+// is on the ESP32: the driver has to bounce it, and a transfer that points
+// into it sends 0xFF bytes instead. len 0 clears it.
+void display_host_set_external(const void *start, size_t len);
+bool display_host_dma_capable(const void *p);
+
+#endif
@@ -0,0 +1,258 @@
+#include "display_image.h"
+#include "display.h"
+#include "display_priv.h"
+#include "esp_heap_caps.h"
+#include <string.h>
+
+typedef struct {
+    uint16_t block_rows;
+    uint16_t reserved;
+} compressed_header_t;
+
+typedef int (*decode_fn_t)(const uint8_t *src, int src_len, uint8_t *dst, int dst_len);
+
+esp_err_t display_image_from_blob(const uint8_t *start, const uint8_t *end, display_image_t *img) {
+    display_image_header_t hdr;
+
+    if (end - start < (ptrdiff_t)sizeof(hdr)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    memcpy(&hdr, start, sizeof(hdr));
+    if (hdr.magic[0] != DISPLAY_IMAGE_MAGIC0 || hdr.magic[1] != DISPLAY_IMAGE_MAGIC1) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    img->width = hdr.width;
+    img->height = hdr.height;
+    img->format = hdr.format;
+    img->data = start + sizeof(hdr);
+    img->size = end - img->data;
+
+    switch (img->format) {
+    case DISPLAY_IMAGE_RGB565:
+        if (img->size < (size_t)img->width * img->height * 2) {
+            return ESP_ERR_INVALID_SIZE;
+        }
+        return ESP_OK;
+    case DISPLAY_IMAGE_RLE:
+    case DISPLAY_IMAGE_LZ4:
+        if (img->size < sizeof(compressed_header_t)) {
+            return ESP_ERR_INVALID_SIZE;
+        }
+        return ESP_OK;
+    default:
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+}
+
+void draw_image_asset(uint16_t x0, uint16_t y0, const display_image_t *img) {
+    switch (img->format) {
+    case DISPLAY_IMAGE_RGB565:
+        // Already in panel byte order: stream it as-is
+        draw_image(x0, y0, img->width, img->height, (const uint16_t *)img->data);
+        break;
+    case DISPLAY_IMAGE_RLE:
+    case DISPLAY_IMAGE_LZ4:
+        draw_image_compressed(x0, y0, img);
+        break;
+    }
+}
+
+/* Returns the number of bytes written to dst, or -1 on malformed input. */
+static int rle_decode(const uint8_t *src, int src_len, uint8_t *dst, int dst_len) {
+    const uint8_t *end = src + src_len;
+    uint8_t *out = dst;
+
+    while (src < end) {
+        int c = *src++;
+        int n = (c & 0x7F) + 1;
+        if (out + n * 2 > dst + dst_len) return -1;
+
+        if (c & 0x80) {
+            if (end - src < 2) return -1;
+            uint8_t hi = src[0], lo = src[1];
+            src += 2;
+            for (int i = 0; i < n; i++) {
+                *out++ = hi;
+                *out++ = lo;
+            }
+        } else {
+            if (end - src < n * 2) return -1;
+            memcpy(out, src, n * 2);
+            src += n * 2;
+            out += n * 2;
+        }
+    }
+    return out - dst;
+}
+
+/* Raw LZ4 block decoder. Returns the number of bytes written to dst, or -1 on
+ * malformed input. */
+static int lz4_decode(const uint8_t *src, int src_len, uint8_t *dst, int dst_len) {
+    const uint8_t *end = src + src_len;
+    uint8_t *out = dst;
+    uint8_t *out_end = dst + dst_len;
+
+    while (src < end) {
+        int token = *src++;
+
+        int lit = token >> 4;
+        if (lit == 15) {
+            int b;
+            do {
+                if (src >= end) return -1;
+                b = *src++;
+                lit += b;
+            } while (b == 255);
+        }
+        if (end - src < lit || out_end - out < lit) return -1;
+        memcpy(out, src, lit);
+        src += lit;
+        out += lit;
+
+        if (src >= end) break;    // the last sequence has no match
+
+        if (end - src < 2) return -1;
+        int offset = src[0] | (src[1] << 8);
+        src += 2;
+        if (offset == 0 || offset > out - dst) return -1;
+
+        int len = (token & 0x0F) + 4;
+        if ((token & 0x0F) == 15) {
+            int b;
+            do {
+                if (src >= end) return -1;
+                b = *src++;
+                len += b;
+            } while (b == 255);
+        }
+        if (out_end - out < len) return -1;
+
+        // Byte by byte: matches may overlap the bytes they produce
+        const uint8_t *match = out - offset;
+        for (int i = 0; i < len; i++) {
+            *out++ = *match++;
+        }
+    }
+    return out - dst;
+}
+
+// Walks the bands of a compressed image
+typedef struct {
+    decode_fn_t decode;
+    int block_rows;
+    const uint8_t *src;
+    const uint8_t *end;
+} band_reader_t;
+
+static esp_err_t band_reader_init(band_reader_t *r, const display_image_t *img) {
+    switch (img->format) {
+    case DISPLAY_IMAGE_RLE: r->decode = rle_decode; break;
+    case DISPLAY_IMAGE_LZ4: r->decode = lz4_decode; break;
+    default: return ESP_ERR_NOT_SUPPORTED;
+    }
+
+    compressed_header_t ch;
+    memcpy(&ch, img->data, sizeof(ch));
+    if (ch.block_rows == 0) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    r->block_rows = ch.block_rows;
+    r->src = img->data + sizeof(ch);
+    r->end = img->data + img->size;
+    return ESP_OK;
+}
+
+/* Expand the next band, which must come out as exactly len bytes. */
+static esp_err_t band_read(band_reader_t *r, uint8_t *dst, int len) {
+    uint32_t clen;
+
+    if (r->end - r->src < (ptrdiff_t)sizeof(clen)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    memcpy(&clen, r->src, sizeof(clen));
+    r->src += sizeof(clen);
+    if ((uint32_t)(r->end - r->src) < clen) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    if (r->decode(r->src, clen, dst, len) != len) {
+        return ESP_ERR_INVALID_RESPONSE;
+    }
+    r->src += clen;
+    return ESP_OK;
+}
+
+/* Decode one band at a time into a ping-pong DMA buffer; the previous band
+ * keeps the bus busy while the next one is expanded. */
+esp_err_t draw_image_compressed(uint16_t x0, uint16_t y0, const display_image_t *img) {
+    band_reader_t rd;
+    esp_err_t ret = band_reader_init(&rd, img);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    int row_bytes = img->width * 2;
+    display_pingpong_t pp;
+    ret = display_pp_init(&pp, row_bytes * rd.block_rows);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    set_window(x0, y0, x0 + img->width - 1, y0 + img->height - 1);
+
+    for (int y = 0; y < img->height; y += rd.block_rows) {
+        int rows = (img->height - y < rd.block_rows) ? img->height - y : rd.block_rows;
+        uint8_t *buf = display_pp_next(&pp);
+        ret = band_read(&rd, buf, rows * row_bytes);
+        if (ret != ESP_OK) {
+            break;
+        }
+        display_pp_submit(&pp, rows * row_bytes);
+    }
+
+    display_pp_free(&pp);
+    return ret;
+}
+
+/* PSRAM when there is some: the cache exists to keep internal RAM free, and
+ * display_queue_data() bounces what the DMA can't read. */
+esp_err_t display_image_cache(const display_image_t *img, display_image_t *cached) {
+    size_t bytes = (size_t)img->width * img->height * 2;
+    uint8_t *pixels = heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM);
+    if (!pixels) {
+        pixels = heap_caps_malloc(bytes, MALLOC_CAP_8BIT);
+    }
+    if (!pixels) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    esp_err_t ret = ESP_OK;
+    if (img->format == DISPLAY_IMAGE_RGB565) {
+        memcpy(pixels, img->data, bytes);
+    } else {
+        band_reader_t rd;
+        ret = band_reader_init(&rd, img);
+        int row_bytes = img->width * 2;
+        for (int y = 0; ret == ESP_OK && y < img->height; y += rd.block_rows) {
+            int rows = (img->height - y < rd.block_rows) ? img->height - y : rd.block_rows;
+            ret = band_read(&rd, pixels + y * row_bytes, rows * row_bytes);
+        }
+    }
+    if (ret != ESP_OK) {
+        heap_caps_free(pixels);
+        return ret;
+    }
+
+    cached->width = img->width;
+    cached->height = img->height;
+    cached->format = DISPLAY_IMAGE_RGB565;
+    cached->data = pixels;
+    cached->size = bytes;
+    return ESP_OK;
+}
+
+void display_image_uncache(display_image_t *cached) {
+    heap_caps_free((void *)cached->data);
+    cached->data = NULL;
+    cached->size = 0;
+}
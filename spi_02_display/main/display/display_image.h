@@ -0,0 +1,71 @@
+#ifndef DISPLAY_IMAGE_H
+#define DISPLAY_IMAGE_H
+
+#include "esp_err.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Image assets produced at build time by tools/img2rgb565.py and embedded
+ * with display_add_image_assets() (tools/display_assets.cmake).
+ *
+ * A blob is an 8-byte header followed by the pixel data; RGB565 pixels are
+ * stored high byte first, exactly as the panel expects them.
+ *
+ * Compressed formats split the image into bands of block_rows rows that
+ * decode independently, so each band can be expanded straight into a DMA
+ * buffer while the previous one is still being sent:
+ *
+ *     uint16_t block_rows, reserved
+ *     per band: uint32_t compressed size, compressed bytes
+ *
+ * RLE works on 16-bit pixels: a control byte c < 0x80 is followed by c + 1
+ * literal pixels, c >= 0x80 by one pixel repeated (c & 0x7F) + 1 times.
+ * LZ4 bands are raw LZ4 blocks (no frame header).
+ */
+
+#define DISPLAY_IMAGE_MAGIC0 'I'
+#define DISPLAY_IMAGE_MAGIC1 'M'
+
+typedef enum {
+    DISPLAY_IMAGE_RGB565 = 0,
+    DISPLAY_IMAGE_RLE = 1,
+    DISPLAY_IMAGE_LZ4 = 2,
+} display_image_format_t;
+
+typedef struct {
+    uint8_t magic[2];
+    uint8_t format;
+    uint8_t flags;
+    uint16_t width;
+    uint16_t height;
+} display_image_header_t;
+
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    display_image_format_t format;
+    const uint8_t *data;    // pixel data following the header
+    size_t size;            // bytes of pixel data
+} display_image_t;
+
+// Declare the linker symbols of an embedded asset, e.g. for assets/splash.png:
+//     DISPLAY_IMAGE_DECLARE(splash);
+//     display_image_from_blob(DISPLAY_IMAGE_START(splash), DISPLAY_IMAGE_END(splash), &img);
+#define DISPLAY_IMAGE_DECLARE(name)                                                 \
+    extern const uint8_t _binary_##name##_img_start[] asm("_binary_" #name "_img_start"); \
+    extern const uint8_t _binary_##name##_img_end[] asm("_binary_" #name "_img_end")
+#define DISPLAY_IMAGE_START(name) _binary_##name##_img_start
+#define DISPLAY_IMAGE_END(name)   _binary_##name##_img_end
+
+esp_err_t display_image_from_blob(const uint8_t *start, const uint8_t *end, display_image_t *img);
+void draw_image_asset(uint16_t x0, uint16_t y0, const display_image_t *img);
+esp_err_t draw_image_compressed(uint16_t x0, uint16_t y0, const display_image_t *img);
+
+// Asset cache: expand img once into plain RGB565 in RAM, in PSRAM when the
+// board has it, so redraws are a straight blit. Release with
+// display_image_uncache() once nothing is drawing from it.
+esp_err_t display_image_cache(const display_image_t *img, display_image_t *cached);
+void display_image_uncache(display_image_t *cached);
+
+#endif
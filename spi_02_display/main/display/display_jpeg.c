@@ -0,0 +1,290 @@
+#include "display_jpeg.h"
+#include "display.h"
+#include "display_priv.h"
+#include "esp_rom_tjpgd.h"
+#include <stdlib.h>
+#include <string.h>
+#if CONFIG_DISPLAY_JPEG_DUAL_CORE
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#endif
+
+// Work area for the ROM decoder: Huffman and quantization tables plus one
+// MCU; 3100 bytes covers every baseline image.
+#define JPEG_WORK_SIZE 3100
+
+typedef struct {
+    const uint8_t *data;
+    size_t len;
+    size_t pos;
+    uint16_t img_w;             // scaled image size
+    uint16_t img_h;
+    uint16_t vis_w;             // part of it that is on screen
+    uint16_t vis_h;
+    int band_rows;              // pixel rows per MCU row at the output scale
+    display_pingpong_t pp;
+    uint16_t *band;             // band being filled, NULL between MCU rows
+#if CONFIG_DISPLAY_JPEG_DUAL_CORE
+    QueueHandle_t full;         // jpeg_row_t, decoded rows for the caller
+    QueueHandle_t free;         // uint8_t *, RGB888 rows for the decoder
+    uint8_t *rgb;               // row being filled, NULL between MCU rows
+    uint8_t *rgb_buf[2];
+    esp_rom_tjpgd_dec_t *dec;
+    uint8_t scale;
+    TaskHandle_t caller;
+#endif
+} jpeg_ctx_t;
+
+static esp_err_t jpeg_err(esp_rom_tjpgd_result_t res) {
+    switch (res) {
+    case JDR_OK:
+    case JDR_INTR:      // stopped by us below the screen
+        return ESP_OK;
+    case JDR_MEM1:
+    case JDR_MEM2:
+        return ESP_ERR_NO_MEM;
+    case JDR_FMT2:      // wrong structure
+    case JDR_FMT3:      // progressive or other unsupported coding
+        return ESP_ERR_NOT_SUPPORTED;
+    default:
+        return ESP_ERR_INVALID_ARG;
+    }
+}
+
+/* Input callback: copy (or with buf NULL, skip) up to len bytes. */
+static uint32_t jpeg_in(esp_rom_tjpgd_dec_t *dec, uint8_t *buf, uint32_t len) {
+    jpeg_ctx_t *ctx = dec->device;
+    size_t left = ctx->len - ctx->pos;
+    if (len > left) len = left;
+    if (buf) memcpy(buf, ctx->data + ctx->pos, len);
+    ctx->pos += len;
+    return len;
+}
+
+static inline uint16_t rgb888_to_panel(const uint8_t *p) {
+    uint16_t c = ((p[0] & 0xF8) << 8) | ((p[1] & 0xFC) << 3) | (p[2] >> 3);
+    return DISPLAY_SWAP16(c);
+}
+
+/* Clip an MCU against the visible area; returns its width on screen, 0 if
+ * none of it is. */
+static int jpeg_clip(const jpeg_ctx_t *ctx, const esp_rom_tjpgd_rect_t *r, int *rows) {
+    int right = r->right < ctx->vis_w ? r->right : ctx->vis_w - 1;
+    int bottom = r->bottom < ctx->vis_h ? r->bottom : ctx->vis_h - 1;
+    *rows = bottom - r->top + 1;
+    return (r->left < ctx->vis_w) ? right - r->left + 1 : 0;
+}
+
+/* Rows of the band that is complete once the MCU ending at r is in. */
+static inline int jpeg_band_rows(const jpeg_ctx_t *ctx, const esp_rom_tjpgd_rect_t *r) {
+    return (r->top + ctx->band_rows <= ctx->vis_h) ? ctx->band_rows : ctx->vis_h - r->top;
+}
+
+/* Output callback: convert one decoded MCU (RGB888) into the band, and send
+ * the band once the last MCU of the row is in. Returning 0 below the screen
+ * ends the decode. */
+static uint32_t jpeg_out(esp_rom_tjpgd_dec_t *dec, void *bitmap, esp_rom_tjpgd_rect_t *r) {
+    jpeg_ctx_t *ctx = dec->device;
+    if (r->top >= ctx->vis_h) return 0;
+
+    if (!ctx->band) {
+        ctx->band = (uint16_t *)display_pp_next(&ctx->pp);
+    }
+
+    int rows;
+    int w = jpeg_clip(ctx, r, &rows);
+    const uint8_t *src = bitmap;
+    int src_w = r->right - r->left + 1;
+    for (int y = 0; w && y < rows; y++) {
+        uint16_t *dst = ctx->band + y * ctx->vis_w + r->left;
+        const uint8_t *s = src + y * src_w * 3;
+        for (int x = 0; x < w; x++, s += 3) {
+            dst[x] = rgb888_to_panel(s);
+        }
+    }
+
+    if (r->right >= ctx->img_w - 1) {
+        display_pp_submit(&ctx->pp, jpeg_band_rows(ctx, r) * ctx->vis_w * 2);
+        ctx->band = NULL;
+    }
+    return 1;
+}
+
+#if CONFIG_DISPLAY_JPEG_DUAL_CORE
+
+typedef struct {
+    uint8_t *rgb;               // NULL: end of image
+    int rows;
+    esp_rom_tjpgd_result_t res;
+} jpeg_row_t;
+
+/* Decoder side: copy the visible part of each MCU into an RGB888 row and
+ * hand the row over when it is complete. */
+static uint32_t jpeg_out_rgb(esp_rom_tjpgd_dec_t *dec, void *bitmap, esp_rom_tjpgd_rect_t *r) {
+    jpeg_ctx_t *ctx = dec->device;
+    if (r->top >= ctx->vis_h) return 0;
+
+    if (!ctx->rgb) {
+        xQueueReceive(ctx->free, &ctx->rgb, portMAX_DELAY);
+    }
+
+    int rows;
+    int w = jpeg_clip(ctx, r, &rows);
+    const uint8_t *src = bitmap;
+    int src_w = r->right - r->left + 1;
+    for (int y = 0; w && y < rows; y++) {
+        uint8_t *dst = ctx->rgb + (y * ctx->vis_w + r->left) * 3;
+        memcpy(dst, src + y * src_w * 3, w * 3);
+    }
+
+    if (r->right >= ctx->img_w - 1) {
+        jpeg_row_t row = {ctx->rgb, jpeg_band_rows(ctx, r), JDR_OK};
+        xQueueSend(ctx->full, &row, portMAX_DELAY);
+        ctx->rgb = NULL;
+    }
+    return 1;
+}
+
+static void jpeg_decode_task(void *arg) {
+    jpeg_ctx_t *ctx = arg;
+    jpeg_row_t end = {NULL, 0, JDR_OK};
+
+    end.res = esp_rom_tjpgd_decomp(ctx->dec, jpeg_out_rgb, ctx->scale);
+    xQueueSend(ctx->full, &end, portMAX_DELAY);
+    // ctx lives on the caller's stack: nothing may touch it after this
+    xTaskNotifyGive(ctx->caller);
+    vTaskDelete(NULL);
+}
+
+/* Entropy decode and IDCT run on the other core; this one converts the
+ * rows it gets back to panel RGB565 and keeps the bus fed. */
+static esp_err_t jpeg_decode_dual(jpeg_ctx_t *ctx, esp_rom_tjpgd_dec_t *dec, uint8_t scale) {
+    int row_bytes = ctx->vis_w * ctx->band_rows * 3;
+    esp_err_t ret = ESP_ERR_NO_MEM;
+
+    ctx->dec = dec;
+    ctx->scale = scale;
+    ctx->caller = xTaskGetCurrentTaskHandle();
+    ctx->full = xQueueCreate(3, sizeof(jpeg_row_t));
+    ctx->free = xQueueCreate(2, sizeof(uint8_t *));
+    ctx->rgb_buf[0] = malloc(row_bytes);
+    ctx->rgb_buf[1] = malloc(row_bytes);
+    if (!ctx->full || !ctx->free || !ctx->rgb_buf[0] || !ctx->rgb_buf[1]) {
+        goto out;
+    }
+    xQueueSend(ctx->free, &ctx->rgb_buf[0], 0);
+    xQueueSend(ctx->free, &ctx->rgb_buf[1], 0);
+
+    if (xTaskCreatePinnedToCore(jpeg_decode_task, "jpeg_dec", 3072, ctx, uxTaskPriorityGet(NULL),
+                                NULL, !xPortGetCoreID()) != pdPASS) {
+        goto out;
+    }
+
+    for (;;) {
+        jpeg_row_t row;
+        xQueueReceive(ctx->full, &row, portMAX_DELAY);
+        if (!row.rgb) {
+            ret = jpeg_err(row.res);
+            break;
+        }
+        uint16_t *band = (uint16_t *)display_pp_next(&ctx->pp);
+        int n = row.rows * ctx->vis_w;
+        for (int i = 0; i < n; i++) {
+            band[i] = rgb888_to_panel(row.rgb + i * 3);
+        }
+        display_pp_submit(&ctx->pp, n * 2);
+        xQueueSend(ctx->free, &row.rgb, portMAX_DELAY);
+    }
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+out:
+    free(ctx->rgb_buf[0]);
+    free(ctx->rgb_buf[1]);
+    if (ctx->full) vQueueDelete(ctx->full);
+    if (ctx->free) vQueueDelete(ctx->free);
+    return ret;
+}
+
+#endif
+
+/* Output size along one axis the way TJpgDec scales it: every MCU on its
+ * own, rounding down, so a partial MCU at the edge shrinks more than the
+ * image would and is dropped altogether if it scales to nothing. The last
+ * MCU of each row then ends exactly at img_w - 1. */
+static uint16_t jpeg_scaled(uint16_t size, int mcu, uint8_t scale) {
+    return (size / mcu) * (mcu >> scale) + ((size % mcu) >> scale);
+}
+
+static esp_err_t jpeg_prepare(jpeg_ctx_t *ctx, esp_rom_tjpgd_dec_t *dec, void *work,
+                              const uint8_t *data, size_t len, uint8_t scale) {
+    if (scale > 3) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->data = data;
+    ctx->len = len;
+
+    esp_err_t ret = jpeg_err(esp_rom_tjpgd_prepare(dec, jpeg_in, work, JPEG_WORK_SIZE, ctx));
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    ctx->img_w = jpeg_scaled(dec->width, dec->msx * 8, scale);
+    ctx->img_h = jpeg_scaled(dec->height, dec->msy * 8, scale);
+    ctx->band_rows = (dec->msy * 8) >> scale;
+    if (ctx->band_rows == 0) ctx->band_rows = 1;
+    return ESP_OK;
+}
+
+esp_err_t display_jpeg_size(const uint8_t *data, size_t len, uint8_t scale, uint16_t *w, uint16_t *h) {
+    jpeg_ctx_t ctx;
+    esp_rom_tjpgd_dec_t dec;
+    void *work = malloc(JPEG_WORK_SIZE);
+    if (!work) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    esp_err_t ret = jpeg_prepare(&ctx, &dec, work, data, len, scale);
+    if (ret == ESP_OK) {
+        *w = ctx.img_w;
+        *h = ctx.img_h;
+    }
+    free(work);
+    return ret;
+}
+
+esp_err_t draw_jpeg(uint16_t x0, uint16_t y0, const uint8_t *data, size_t len, uint8_t scale) {
+    if (x0 >= display_width() || y0 >= display_height()) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    jpeg_ctx_t ctx;
+    esp_rom_tjpgd_dec_t dec;
+    void *work = malloc(JPEG_WORK_SIZE);
+    if (!work) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    esp_err_t ret = jpeg_prepare(&ctx, &dec, work, data, len, scale);
+    if (ret != ESP_OK || ctx.img_w == 0 || ctx.img_h == 0) {
+        goto out;       // an image smaller than one MCU can scale to nothing
+    }
+    ctx.vis_w = (ctx.img_w < display_width() - x0) ? ctx.img_w : display_width() - x0;
+    ctx.vis_h = (ctx.img_h < display_height() - y0) ? ctx.img_h : display_height() - y0;
+
+    ret = display_pp_init(&ctx.pp, ctx.vis_w * ctx.band_rows * 2);
+    if (ret != ESP_OK) {
+        goto out;
+    }
+
+    set_window(x0, y0, x0 + ctx.vis_w - 1, y0 + ctx.vis_h - 1);
+#if CONFIG_DISPLAY_JPEG_DUAL_CORE
+    ret = jpeg_decode_dual(&ctx, &dec, scale);
+#else
+    ret = jpeg_err(esp_rom_tjpgd_decomp(&dec, jpeg_out, scale));
+#endif
+    display_pp_free(&ctx.pp);
+
+out:
+    free(work);
+    return ret;
+}
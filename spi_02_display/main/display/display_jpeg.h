@@ -0,0 +1,38 @@
+#ifndef DISPLAY_JPEG_H
+#define DISPLAY_JPEG_H
+
+#include "esp_err.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Baseline JPEG drawing with the TJpgDec decoder in the ESP32 ROM (not
+ * available on the linux target).
+ *
+ * The image is decoded one MCU row (8 or 16 pixel rows) at a time straight
+ * into a ping-pong DMA band in panel byte order, so the next row decodes
+ * while the previous one is on the bus. Only the part that fits on screen
+ * is sent; decoding stops below the bottom edge.
+ *
+ * With CONFIG_DISPLAY_JPEG_DUAL_CORE the entropy decode and IDCT run in a
+ * task on the other core, while the calling core converts finished rows
+ * to RGB565 and feeds the bus.
+ *
+ * JPEG files in the asset directory are embedded unchanged by
+ * display_add_image_assets(); "assets/photo.jpg" becomes:
+ *     DISPLAY_JPEG_DECLARE(photo);
+ *     draw_jpeg(0, 0, DISPLAY_JPEG_START(photo), DISPLAY_JPEG_SIZE(photo), 0);
+ */
+
+#define DISPLAY_JPEG_DECLARE(name)                                                  \
+    extern const uint8_t _binary_##name##_jpg_start[] asm("_binary_" #name "_jpg_start"); \
+    extern const uint8_t _binary_##name##_jpg_end[] asm("_binary_" #name "_jpg_end")
+#define DISPLAY_JPEG_START(name) _binary_##name##_jpg_start
+#define DISPLAY_JPEG_SIZE(name)  ((size_t)(_binary_##name##_jpg_end - _binary_##name##_jpg_start))
+
+// Size of the image as drawn at scale (0..3: 1/1, 1/2, 1/4, 1/8)
+esp_err_t display_jpeg_size(const uint8_t *data, size_t len, uint8_t scale, uint16_t *w, uint16_t *h);
+
+esp_err_t draw_jpeg(uint16_t x0, uint16_t y0, const uint8_t *data, size_t len, uint8_t scale);
+
+#endif
@@ -0,0 +1,43 @@
+#include "display_priv.h"
+#include "esp_heap_caps.h"
+
+esp_err_t display_pp_init(display_pingpong_t *pp, int size) {
+    pp->size = size;
+    pp->cur = 0;
+    for (int i = 0; i < 2; i++) {
+        pp->buf[i] = heap_caps_malloc(size, MALLOC_CAP_DMA);
+        pp->seq[i] = display_trans_seq();
+    }
+    if (!pp->buf[0] || !pp->buf[1]) {
+        display_pp_free(pp);
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+/* Waits for both buffers to leave the bus before releasing them. */
+void display_pp_free(display_pingpong_t *pp) {
+    for (int i = 0; i < 2; i++) {
+        if (pp->buf[i]) {
+            display_wait_seq(pp->seq[i]);
+            heap_caps_free(pp->buf[i]);
+            pp->buf[i] = NULL;
+        }
+    }
+}
+
+uint8_t *display_pp_next(display_pingpong_t *pp) {
+    display_wait_seq(pp->seq[pp->cur]);
+    return pp->buf[pp->cur];
+}
+
+/* Queue the first len bytes of the current buffer and switch to the other. */
+void display_pp_submit(display_pingpong_t *pp, int len) {
+    display_pp_submit_cb(pp, len, NULL, NULL);
+}
+
+void display_pp_submit_cb(display_pingpong_t *pp, int len, display_done_cb_t done_cb, void *arg) {
+    display_queue_data(pp->buf[pp->cur], len, done_cb, arg);
+    pp->seq[pp->cur] = display_trans_seq();
+    pp->cur ^= 1;
+}
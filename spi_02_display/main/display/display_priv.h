@@ -0,0 +1,66 @@
+#ifndef DISPLAY_PRIV_H
+#define DISPLAY_PRIV_H
+
+// Helpers shared between the display modules; not part of the public API.
+
+#include "display.h"
+#include "freertos/semphr.h"
+#include <stdint.h>
+
+// Panel memory in its native portrait scan. The logical screen is
+// display_width() x display_height(), which trade places when rotated.
+#define DISPLAY_PANEL_WIDTH  240
+#define DISPLAY_PANEL_HEIGHT 320
+
+// RGB565 colors go out high byte first; buffers handed to the DMA hold them
+// pre-swapped so they can be streamed without a conversion pass.
+#define DISPLAY_SWAP16(c) ((uint16_t)(((c) >> 8) | ((c) << 8)))
+
+// ILI9341 frame rate = FOSC / (RTNA * DIVA * (320 + VFP + VBP)), with the
+// default 2-line front and back porch; ili9341_init() leaves RTNA at 0x18.
+#define DISPLAY_FRC_FOSC_HZ 615000
+#define DISPLAY_FRC_LINES   (DISPLAY_PANEL_HEIGHT + 2 + 2)
+#define DISPLAY_REFRESH_HZ_DEFAULT (DISPLAY_FRC_FOSC_HZ / (0x18 * DISPLAY_FRC_LINES))
+
+void send_cmd(uint8_t cmd);
+void send_data(const uint8_t *data, int len);
+void set_window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+void display_queue_data(const void *data, int len, display_done_cb_t done_cb, void *arg);
+uint32_t display_trans_seq(void);
+void display_wait_seq(uint32_t seq);
+
+// Per-panel scroll and TE state, kept in the selected panel's display_t
+// (display_scroll.c, display_vsync.c).
+typedef struct {
+    uint16_t top;               // area in panel memory rows: [top, top + height)
+    uint16_t height;
+    uint16_t start;             // memory row shown at the top of the area
+} display_scroll_state_t;
+
+typedef struct {
+    SemaphoreHandle_t sem;      // given on every V-blank edge
+    volatile uint32_t count;    // V-blank edges seen
+    bool enabled;
+    int refresh_hz;
+} display_vsync_state_t;
+
+display_scroll_state_t *display_scroll_state(void);
+display_vsync_state_t *display_vsync_state(void);
+
+// Two DMA buffers that take turns: one is filled by the CPU while the other
+// is on the wire. display_pp_next() returns the buffer to fill next, waiting
+// only for that buffer's own transfer to finish.
+typedef struct {
+    uint8_t *buf[2];
+    int size;
+    int cur;
+    uint32_t seq[2];
+} display_pingpong_t;
+
+esp_err_t display_pp_init(display_pingpong_t *pp, int size);
+void display_pp_free(display_pingpong_t *pp);
+uint8_t *display_pp_next(display_pingpong_t *pp);
+void display_pp_submit(display_pingpong_t *pp, int len);
+void display_pp_submit_cb(display_pingpong_t *pp, int len, display_done_cb_t done_cb, void *arg);
+
+#endif
@@ -0,0 +1,71 @@
+#include "display_readback.h"
+#include "display.h"
+#include "display_priv.h"
+#include "esp_heap_caps.h"
+#include <stdlib.h>
+
+// Rows read back per display_read_region() call; every call pays for two
+// clock switches
+#define SHOT_ROWS 8
+
+esp_err_t display_write_file(void *ctx, const void *data, size_t len) {
+    return fwrite(data, 1, len, ctx) == len ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t display_screenshot_ppm(display_write_fn_t write, void *ctx) {
+    int w = display_width(), h = display_height();
+    uint16_t *px = malloc(w * SHOT_ROWS * sizeof(uint16_t));
+    uint8_t *line = malloc(w * 3);
+    if (!px || !line) {
+        free(px);
+        free(line);
+        return ESP_ERR_NO_MEM;
+    }
+
+    char hdr[24];
+    int n = snprintf(hdr, sizeof(hdr), "P6\n%d %d\n255\n", w, h);
+    esp_err_t ret = write(ctx, hdr, n);
+
+    for (int y = 0; ret == ESP_OK && y < h; y += SHOT_ROWS) {
+        int rows = (h - y < SHOT_ROWS) ? h - y : SHOT_ROWS;
+        ret = display_read_region(0, y, w, rows, px);
+        for (int r = 0; ret == ESP_OK && r < rows; r++) {
+            // Each channel widened to eight bits
+            for (int x = 0; x < w; x++) {
+                uint16_t c = DISPLAY_SWAP16(px[r * w + x]);
+                uint8_t cr = c >> 11, cg = (c >> 5) & 0x3F, cb = c & 0x1F;
+                line[x * 3 + 0] = (cr << 3) | (cr >> 2);
+                line[x * 3 + 1] = (cg << 2) | (cg >> 4);
+                line[x * 3 + 2] = (cb << 3) | (cb >> 2);
+            }
+            ret = write(ctx, line, w * 3);
+        }
+    }
+
+    free(px);
+    free(line);
+    return ret;
+}
+
+/* Only the part of the sprite on screen is read and written. */
+esp_err_t display_blend_rmw(const display_alpha_sprite_t *sprite, int x, int y, uint8_t opacity) {
+    int x0 = x < 0 ? 0 : x;
+    int y0 = y < 0 ? 0 : y;
+    int x1 = x + sprite->width;
+    int y1 = y + sprite->height;
+    if (x1 > display_width()) x1 = display_width();
+    if (y1 > display_height()) y1 = display_height();
+    if (x1 <= x0 || y1 <= y0) return ESP_OK;
+
+    int w = x1 - x0, h = y1 - y0;
+    uint16_t *buf = heap_caps_malloc(w * h * sizeof(uint16_t), MALLOC_CAP_DMA);
+    if (!buf) return ESP_ERR_NO_MEM;
+
+    esp_err_t ret = display_read_region(x0, y0, w, h, buf);
+    if (ret == ESP_OK) {
+        display_blend_sprite(sprite, x, y, opacity, buf, x0, y0, w, h);
+        draw_image(x0, y0, w, h, buf);
+    }
+    heap_caps_free(buf);
+    return ret;
+}
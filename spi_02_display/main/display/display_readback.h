@@ -0,0 +1,32 @@
+#ifndef DISPLAY_READBACK_H
+#define DISPLAY_READBACK_H
+
+#include "esp_err.h"
+#include "display_blend.h"
+#include <stddef.h>
+#include <stdio.h>
+
+/*
+ * What needs the picture already on the panel, read back over MISO with
+ * display_read_region() instead of kept in a framebuffer. Both need
+ * pin_miso wired and run at the slow read clock (a full screen takes
+ * about 0.3 s), so they suit screenshots and small overlays, not frames.
+ */
+
+// Sink for a byte stream: a file, a socket, the console. Returning an
+// error stops the screenshot and is passed on.
+typedef esp_err_t (*display_write_fn_t)(void *ctx, const void *data, size_t len);
+
+// Writes to the FILE * given as ctx
+esp_err_t display_write_file(void *ctx, const void *data, size_t len);
+
+// The logical screen as a binary PPM (P6), read back a few rows at a time.
+esp_err_t display_screenshot_ppm(display_write_fn_t write, void *ctx);
+
+// Composite a sprite placed at (x, y), scaled by opacity, over what the
+// panel shows: its box is read back, blended and written again. To take a
+// cursor away later, read its box with display_read_region() first and
+// draw_image() it back.
+esp_err_t display_blend_rmw(const display_alpha_sprite_t *sprite, int x, int y, uint8_t opacity);
+
+#endif
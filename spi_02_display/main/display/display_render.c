@@ -0,0 +1,277 @@
+#include "display_render.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include <string.h>
+
+typedef enum {
+    OP_FILL,
+    OP_IMAGE,
+    OP_SHAPE,
+    OP_TEXT,
+    OP_CALL,
+    OP_SYNC,
+    OP_STOP,
+    OP_NONE,            // dropped by coalescing
+} op_type_t;
+
+typedef struct {
+    op_type_t type;
+    uint16_t x0, y0, x1, y1;    // box of fills and images, inclusive
+    union {
+        uint16_t color;
+        struct {
+            const uint16_t *pixels;
+            display_done_cb_t done_cb;
+            void *arg;
+        } image;
+        display_shape_t shape;
+        struct {
+            const display_font_t *font;
+            uint16_t fg, bg;
+            char str[DISPLAY_POST_TEXT_MAX];
+        } text;
+        struct {
+            display_render_fn_t fn;
+            void *arg;
+        } call;
+        SemaphoreHandle_t done;     // sync and stop
+    };
+} render_op_t;
+
+static QueueHandle_t render_queue;
+static TaskHandle_t render_task;
+static render_op_t batch[DISPLAY_RENDER_BATCH];   // only touched by the task
+
+/* Inclusive screen box of a drawing op; false for barriers. */
+static bool op_box(const render_op_t *op, int *x0, int *y0, int *x1, int *y1) {
+    switch (op->type) {
+    case OP_FILL:
+    case OP_IMAGE:
+        *x0 = op->x0;
+        *y0 = op->y0;
+        *x1 = op->x1;
+        *y1 = op->y1;
+        return true;
+    case OP_SHAPE:
+        display_shape_bounds(&op->shape, x0, y0, x1, y1);
+        return true;
+    case OP_TEXT:
+        *x0 = op->x0;
+        *y0 = op->y0;
+        *x1 = op->x0 + display_text_width(op->text.font, op->text.str) - 1;
+        *y1 = op->y0 + op->text.font->line_height - 1;
+        return true;
+    default:
+        return false;
+    }
+}
+
+static void op_drop(render_op_t *op) {
+    if (op->type == OP_IMAGE && op->image.done_cb) {
+        op->image.done_cb(op->image.arg);
+    }
+    op->type = OP_NONE;
+}
+
+/* Two fills of one color whose boxes share a whole edge become the later
+ * one, grown over both. */
+static bool fill_merge(const render_op_t *a, render_op_t *b) {
+    if (a->color != b->color) return false;
+    if (a->x0 == b->x0 && a->x1 == b->x1 && (a->y1 + 1 == b->y0 || b->y1 + 1 == a->y0)) {
+        b->y0 = a->y0 < b->y0 ? a->y0 : b->y0;
+        b->y1 = a->y1 > b->y1 ? a->y1 : b->y1;
+        return true;
+    }
+    if (a->y0 == b->y0 && a->y1 == b->y1 && (a->x1 + 1 == b->x0 || b->x1 + 1 == a->x0)) {
+        b->x0 = a->x0 < b->x0 ? a->x0 : b->x0;
+        b->x1 = a->x1 > b->x1 ? a->x1 : b->x1;
+        return true;
+    }
+    return false;
+}
+
+/* Coalesce the ops between two barriers. An op entirely under a later fill
+ * can go whatever lies between them: everything it drew is painted over,
+ * and nothing outside its box depended on it. */
+static void coalesce(render_op_t *ops, int n) {
+    for (int j = 1; j < n; j++) {
+        render_op_t *f = &ops[j];
+        if (f->type != OP_FILL) continue;
+
+        // Merge with the closest earlier op that is still drawn
+        for (int i = j - 1; i >= 0; i--) {
+            if (ops[i].type == OP_NONE) continue;
+            if (ops[i].type == OP_FILL && fill_merge(&ops[i], f)) {
+                ops[i].type = OP_NONE;
+            }
+            break;
+        }
+        for (int i = 0; i < j; i++) {
+            int x0, y0, x1, y1;
+            if (ops[i].type == OP_NONE || !op_box(&ops[i], &x0, &y0, &x1, &y1)) continue;
+            if (x0 >= f->x0 && x1 <= f->x1 && y0 >= f->y0 && y1 <= f->y1) {
+                op_drop(&ops[i]);
+            }
+        }
+    }
+}
+
+static void op_run(render_op_t *op) {
+    switch (op->type) {
+    case OP_FILL:
+        clear_region(op->x0, op->y0, op->x1, op->y1, op->color);
+        break;
+    case OP_IMAGE:
+        draw_image_async(op->x0, op->y0, op->x1 - op->x0 + 1, op->y1 - op->y0 + 1, op->image.pixels,
+                         op->image.done_cb, op->image.arg);
+        break;
+    case OP_SHAPE:
+        draw_shape(&op->shape);
+        break;
+    case OP_TEXT:
+        draw_text(op->x0, op->y0, op->text.str, op->text.font, op->text.fg, op->text.bg);
+        break;
+    case OP_CALL:
+        op->call.fn(op->call.arg);
+        break;
+    case OP_SYNC:
+        display_wait_done();
+        xSemaphoreGive(op->done);
+        break;
+    default:
+        break;
+    }
+}
+
+/* Clip fills to this task's panel, so coalescing compares the boxes that
+ * will be drawn. Posting can't: the poster may have another panel selected. */
+static void clip_fills(render_op_t *ops, int n) {
+    int w = display_width(), h = display_height();
+    for (int i = 0; i < n; i++) {
+        render_op_t *op = &ops[i];
+        if (op->type != OP_FILL) continue;
+        if (op->x1 >= w) op->x1 = w - 1;
+        if (op->y1 >= h) op->y1 = h - 1;
+        if (op->x1 < op->x0 || op->y1 < op->y0) op->type = OP_NONE;
+    }
+}
+
+static void render_task_fn(void *arg) {
+    display_select(arg);
+    while (1) {
+        int n = 0;
+        xQueueReceive(render_queue, &batch[n++], portMAX_DELAY);
+        while (n < DISPLAY_RENDER_BATCH && xQueueReceive(render_queue, &batch[n], 0) == pdTRUE) {
+            n++;
+        }
+        clip_fills(batch, n);
+
+        int start = 0;
+        for (int i = 0; i < n; i++) {
+            if (batch[i].type >= OP_CALL) {
+                coalesce(batch + start, i - start);
+                start = i + 1;
+            }
+        }
+        coalesce(batch + start, n - start);
+
+        for (int i = 0; i < n; i++) {
+            if (batch[i].type == OP_STOP) {
+                display_wait_done();
+                render_task = NULL;
+                xSemaphoreGive(batch[i].done);
+                vTaskDelete(NULL);
+            }
+            op_run(&batch[i]);
+        }
+    }
+}
+
+esp_err_t display_render_start(int queue_len, UBaseType_t priority, BaseType_t core) {
+    if (render_queue) return ESP_ERR_INVALID_STATE;
+
+    render_queue = xQueueCreate(queue_len, sizeof(render_op_t));
+    if (!render_queue) return ESP_ERR_NO_MEM;
+    if (xTaskCreatePinnedToCore(render_task_fn, "disp_render", 4096, display_selected(), priority,
+                                &render_task, core) != pdPASS) {
+        vQueueDelete(render_queue);
+        render_queue = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t post(const render_op_t *op, TickType_t wait) {
+    if (!render_queue) return ESP_ERR_INVALID_STATE;
+    return xQueueSend(render_queue, op, wait) == pdTRUE ? ESP_OK : ESP_ERR_TIMEOUT;
+}
+
+/* Post a sync or stop op and wait for the task to get to it. */
+static esp_err_t post_wait(op_type_t type, TickType_t wait) {
+    StaticSemaphore_t sem_buf;
+    render_op_t op = {.type = type};
+    op.done = xSemaphoreCreateBinaryStatic(&sem_buf);
+
+    esp_err_t ret = post(&op, wait);
+    if (ret == ESP_OK) {
+        xSemaphoreTake(op.done, portMAX_DELAY);
+    }
+    vSemaphoreDelete(op.done);
+    return ret;
+}
+
+void display_render_stop(void) {
+    if (post_wait(OP_STOP, portMAX_DELAY) == ESP_OK) {
+        vQueueDelete(render_queue);
+        render_queue = NULL;
+    }
+}
+
+esp_err_t display_render_sync(TickType_t wait) {
+    return post_wait(OP_SYNC, wait);
+}
+
+esp_err_t display_post_fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color,
+                            TickType_t wait) {
+    if (x1 < x0 || y1 < y0) return ESP_OK;
+
+    render_op_t op = {.type = OP_FILL, .x0 = x0, .y0 = y0, .x1 = x1, .y1 = y1};
+    op.color = color;
+    return post(&op, wait);
+}
+
+esp_err_t display_post_image(uint16_t x0, uint16_t y0, uint16_t w, uint16_t h, const uint16_t *pixels,
+                             display_done_cb_t done_cb, void *arg, TickType_t wait) {
+    if (w == 0 || h == 0) return ESP_ERR_INVALID_ARG;
+
+    render_op_t op = {.type = OP_IMAGE, .x0 = x0, .y0 = y0, .x1 = x0 + w - 1, .y1 = y0 + h - 1};
+    op.image.pixels = pixels;
+    op.image.done_cb = done_cb;
+    op.image.arg = arg;
+    return post(&op, wait);
+}
+
+esp_err_t display_post_shape(const display_shape_t *shape, TickType_t wait) {
+    render_op_t op = {.type = OP_SHAPE};
+    op.shape = *shape;
+    return post(&op, wait);
+}
+
+esp_err_t display_post_text(uint16_t x, uint16_t y, const char *str, const display_font_t *font,
+                            uint16_t fg, uint16_t bg, TickType_t wait) {
+    render_op_t op = {.type = OP_TEXT, .x0 = x, .y0 = y};
+    op.text.font = font;
+    op.text.fg = fg;
+    op.text.bg = bg;
+    strncpy(op.text.str, str, DISPLAY_POST_TEXT_MAX - 1);
+    op.text.str[DISPLAY_POST_TEXT_MAX - 1] = '\0';
+    return post(&op, wait);
+}
+
+esp_err_t display_post_call(display_render_fn_t fn, void *arg, TickType_t wait) {
+    render_op_t op = {.type = OP_CALL};
+    op.call.fn = fn;
+    op.call.arg = arg;
+    return post(&op, wait);
+}
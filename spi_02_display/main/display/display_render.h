@@ -0,0 +1,61 @@
+#ifndef DISPLAY_RENDER_H
+#define DISPLAY_RENDER_H
+
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "display.h"
+#include "display_font.h"
+#include "display_shape.h"
+#include <stdint.h>
+
+/*
+ * Render task: a single task, pinned to a core, owns the display selected
+ * when it is started and runs draw commands that any task posts to its
+ * queue, in posting order. Posting copies the command and returns without
+ * touching SPI; with the queue full it waits up to wait ticks and then
+ * gives up with ESP_ERR_TIMEOUT.
+ *
+ * The task drains what is queued into a batch before drawing it. Within a
+ * batch, fills of one color that share a whole edge merge into a single
+ * window, and commands whose box a later fill covers completely are
+ * dropped. display_post_call() and display_render_sync() are barriers
+ * that nothing is merged across.
+ *
+ * While the task runs it is the only one that may use the drawing API,
+ * for any panel: text, sprites, band lists and scenes keep their scratch
+ * buffers and caches in file statics shared by all panels. Code that must
+ * draw directly (scenes, band lists, the framebuffer) runs on the task
+ * through display_post_call(). Posting reads nothing of the selected
+ * panel; fills are clipped on the task.
+ */
+
+#define DISPLAY_RENDER_BATCH 16
+#define DISPLAY_POST_TEXT_MAX 32
+
+typedef void (*display_render_fn_t)(void *arg);
+
+// core is a core number or tskNO_AFFINITY
+esp_err_t display_render_start(int queue_len, UBaseType_t priority, BaseType_t core);
+// Runs what is queued, then ends the task. Nothing may be posted meanwhile.
+void display_render_stop(void);
+
+esp_err_t display_post_fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color,
+                            TickType_t wait);
+// Like draw_image_async(): pixels must stay valid until done_cb runs. If a
+// later fill covers the image it is never sent and done_cb runs on the
+// render task instead.
+esp_err_t display_post_image(uint16_t x0, uint16_t y0, uint16_t w, uint16_t h, const uint16_t *pixels,
+                             display_done_cb_t done_cb, void *arg, TickType_t wait);
+// The shape is copied; polyline points must stay valid until it is drawn.
+esp_err_t display_post_shape(const display_shape_t *shape, TickType_t wait);
+// draw_text() with a copy of str, cut at DISPLAY_POST_TEXT_MAX - 1 chars
+esp_err_t display_post_text(uint16_t x, uint16_t y, const char *str, const display_font_t *font,
+                            uint16_t fg, uint16_t bg, TickType_t wait);
+// Run fn(arg) on the render task
+esp_err_t display_post_call(display_render_fn_t fn, void *arg, TickType_t wait);
+
+// Block until everything posted before it is on the panel. wait only
+// bounds getting into the queue.
+esp_err_t display_render_sync(TickType_t wait);
+
+#endif
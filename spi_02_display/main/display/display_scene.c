@@ -0,0 +1,134 @@
+#include "display_scene.h"
+#include "display_priv.h"
+#include <string.h>
+
+static display_prim_t scene_prims[DISPLAY_SCENE_MAX];   // per-region list handed to the band renderer
+
+static bool prim_equal(const display_prim_t *a, const display_prim_t *b) {
+    if (a->type != b->type || a->x != b->x || a->y != b->y || a->w != b->w || a->h != b->h) {
+        return false;
+    }
+    switch (a->type) {
+    case DISPLAY_PRIM_FILL:
+        return a->fill.color == b->fill.color;
+    case DISPLAY_PRIM_IMAGE:
+        return a->image.pixels == b->image.pixels;
+    case DISPLAY_PRIM_SPRITE:
+        return a->sprite.sprite == b->sprite.sprite;
+    case DISPLAY_PRIM_TEXT:
+        return a->text.str == b->text.str && a->text.font == b->text.font &&
+               a->text.color == b->text.color;
+    case DISPLAY_PRIM_ALPHA:
+        return a->alpha.sprite == b->alpha.sprite && a->alpha.opacity == b->alpha.opacity;
+    case DISPLAY_PRIM_SHAPE:
+        return a->shape.shape == b->shape.shape;
+    }
+    return false;
+}
+
+/* Mark a primitive's box, clipped to the panel. */
+static void mark_prim(display_scene_t *scene, const display_prim_t *p) {
+    int x0 = p->x < 0 ? 0 : p->x;
+    int y0 = p->y < 0 ? 0 : p->y;
+    int x1 = p->x + p->w - 1;
+    int y1 = p->y + p->h - 1;
+    if (x1 >= display_width()) x1 = display_width() - 1;
+    if (y1 >= display_height()) y1 = display_height() - 1;
+    if (x1 < x0 || y1 < y0) return;
+    display_dirty_add(&scene->dirty, x0, y0, x1, y1);
+}
+
+static bool prim_hits(const display_prim_t *p, const display_rect_t *r) {
+    return p->x <= r->x1 && p->x + p->w > r->x0 && p->y <= r->y1 && p->y + p->h > r->y0;
+}
+
+void display_scene_init(display_scene_t *scene, uint16_t bg) {
+    scene->count = 0;
+    scene->bg = bg;
+    display_dirty_reset(&scene->dirty);
+    display_dirty_add(&scene->dirty, 0, 0, display_width() - 1, display_height() - 1);
+}
+
+esp_err_t display_scene_add(display_scene_t *scene, display_widget_t *widget) {
+    if (scene->count == DISPLAY_SCENE_MAX) return ESP_ERR_NO_MEM;
+    widget->drawn = false;
+    widget->invalid = false;
+    scene->widgets[scene->count++] = widget;
+    return ESP_OK;
+}
+
+void display_scene_remove(display_scene_t *scene, display_widget_t *widget) {
+    for (int i = 0; i < scene->count; i++) {
+        if (scene->widgets[i] == widget) {
+            if (widget->drawn) mark_prim(scene, &widget->last);
+            memmove(&scene->widgets[i], &scene->widgets[i + 1], (scene->count - i - 1) * sizeof(widget));
+            scene->count--;
+            return;
+        }
+    }
+}
+
+void display_scene_invalidate(display_scene_t *scene, display_widget_t *widget) {
+    widget->invalid = true;
+}
+
+void display_scene_invalidate_rect(display_scene_t *scene, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+    if (x1 >= display_width()) x1 = display_width() - 1;
+    if (y1 >= display_height()) y1 = display_height() - 1;
+    display_dirty_add(&scene->dirty, x0, y0, x1, y1);
+}
+
+/* Stable insertion sort by z; scenes are small and mostly sorted already. */
+static void sort_by_z(display_scene_t *scene) {
+    for (int i = 1; i < scene->count; i++) {
+        display_widget_t *w = scene->widgets[i];
+        int j = i;
+        while (j > 0 && scene->widgets[j - 1]->z > w->z) {
+            scene->widgets[j] = scene->widgets[j - 1];
+            j--;
+        }
+        scene->widgets[j] = w;
+    }
+}
+
+esp_err_t display_scene_commit(display_scene_t *scene) {
+    // Diff against the previous frame
+    for (int i = 0; i < scene->count; i++) {
+        display_widget_t *w = scene->widgets[i];
+        bool changed = w->invalid || w->drawn != w->visible ||
+                       (w->visible && !prim_equal(&w->prim, &w->last));
+        if (!changed) continue;
+
+        if (w->drawn) mark_prim(scene, &w->last);
+        if (w->visible) mark_prim(scene, &w->prim);
+        w->invalid = false;
+    }
+
+    sort_by_z(scene);
+
+    esp_err_t ret = ESP_OK;
+    for (int r = 0; r < scene->dirty.count && ret == ESP_OK; r++) {
+        const display_rect_t *rect = &scene->dirty.rects[r];
+        display_list_t list;
+        display_list_init(&list, scene_prims, DISPLAY_SCENE_MAX, scene->bg);
+
+        for (int i = 0; i < scene->count; i++) {
+            const display_widget_t *w = scene->widgets[i];
+            if (w->visible && prim_hits(&w->prim, rect)) {
+                display_list_add(&list, &w->prim);
+            }
+        }
+        ret = display_list_render_region(&list, rect->x0, rect->y0, rect->x1, rect->y1);
+    }
+    if (ret != ESP_OK) {
+        return ret;     // keep the dirty list so the next commit retries
+    }
+
+    display_dirty_reset(&scene->dirty);
+    for (int i = 0; i < scene->count; i++) {
+        display_widget_t *w = scene->widgets[i];
+        w->drawn = w->visible;
+        w->last = w->prim;
+    }
+    return ESP_OK;
+}
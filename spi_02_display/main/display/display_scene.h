@@ -0,0 +1,49 @@
+#ifndef DISPLAY_SCENE_H
+#define DISPLAY_SCENE_H
+
+#include "esp_err.h"
+#include "display_band.h"
+#include "display_dirty.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Retained-mode scene: widgets are registered once with a primitive, a
+ * bounding box and a z-order. display_scene_commit() compares every widget
+ * with what it drew last time, collects the old and new boxes of those that
+ * changed into a dirty-region list, and re-rasterizes only the widgets that
+ * intersect each dirty region through the band renderer.
+ *
+ * Changes are detected from the primitive itself (type, box, color, data
+ * pointers). Content that changes behind an unchanged pointer, such as a
+ * text buffer edited in place, needs display_scene_invalidate().
+ */
+
+#define DISPLAY_SCENE_MAX 32
+
+typedef struct {
+    display_prim_t prim;
+    int16_t z;              // higher draws on top; equal z keeps insertion order
+    bool visible;
+
+    // Managed by the scene
+    bool drawn;
+    bool invalid;
+    display_prim_t last;
+} display_widget_t;
+
+typedef struct {
+    display_widget_t *widgets[DISPLAY_SCENE_MAX];
+    int count;
+    uint16_t bg;
+    display_dirty_t dirty;
+} display_scene_t;
+
+void display_scene_init(display_scene_t *scene, uint16_t bg);
+esp_err_t display_scene_add(display_scene_t *scene, display_widget_t *widget);
+void display_scene_remove(display_scene_t *scene, display_widget_t *widget);
+void display_scene_invalidate(display_scene_t *scene, display_widget_t *widget);
+void display_scene_invalidate_rect(display_scene_t *scene, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+esp_err_t display_scene_commit(display_scene_t *scene);
+
+#endif
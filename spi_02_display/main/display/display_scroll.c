@@ -0,0 +1,58 @@
+#include "display.h"
+#include "display_priv.h"
+
+// The scroll area lives in the selected panel's display_t, see
+// display_scroll_state_t.
+
+/* VSCRDEF: fixed rows above and below the scrolling area. */
+void display_scroll_define(uint16_t top_fixed, uint16_t bottom_fixed) {
+    if (top_fixed + bottom_fixed >= DISPLAY_PANEL_HEIGHT) return;
+
+    display_scroll_state_t *s = display_scroll_state();
+    s->top = top_fixed;
+    s->height = DISPLAY_PANEL_HEIGHT - top_fixed - bottom_fixed;
+    s->start = s->top;
+
+    uint8_t def[] = {
+        top_fixed >> 8, top_fixed & 0xFF,
+        s->height >> 8, s->height & 0xFF,
+        bottom_fixed >> 8, bottom_fixed & 0xFF,
+    };
+    send_cmd(0x33);
+    send_data(def, sizeof(def));
+    display_scroll_to(s->top);
+}
+
+/* VSCRSADD: memory row to show at the top of the scrolling area. */
+void display_scroll_to(uint16_t line) {
+    display_scroll_state_t *s = display_scroll_state();
+    if (line < s->top || line >= s->top + s->height) return;
+
+    s->start = line;
+    uint8_t vsp[] = {line >> 8, line & 0xFF};
+    send_cmd(0x37);
+    send_data(vsp, sizeof(vsp));
+}
+
+/* Memory row currently shown at visible_row (0 = top of the scrolling area). */
+uint16_t display_scroll_row(uint16_t visible_row) {
+    const display_scroll_state_t *s = display_scroll_state();
+    return s->top + (s->start - s->top + visible_row) % s->height;
+}
+
+/* Scroll the area up by lines. The rows that were at the top reappear at
+ * the bottom; the memory row of the first of them is returned so the caller
+ * can draw only the newly exposed lines there. They wrap back to the top
+ * of the area past its end; use display_scroll_row() to map each one. */
+uint16_t display_scroll_advance(uint16_t lines) {
+    display_scroll_state_t *s = display_scroll_state();
+    uint16_t exposed = s->start;
+    display_scroll_to(display_scroll_row(lines % s->height));
+    return exposed;
+}
+
+/* Leave scroll mode: whole-panel area, normal display mode (NORON). */
+void display_scroll_reset(void) {
+    display_scroll_define(0, 0);
+    send_cmd(0x13);
+}
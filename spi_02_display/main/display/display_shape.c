@@ -0,0 +1,305 @@
+#include "display_shape.h"
+#include "display.h"
+#include "display_priv.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* Where spans go. Spans reach emit() already clipped and with x0 <= x1. */
+typedef struct span_sink span_sink_t;
+struct span_sink {
+    void (*emit)(span_sink_t *s, int x0, int x1, int y);
+    int clip_x0, clip_y0, clip_x1, clip_y1;     // inclusive
+    uint16_t color;             // panel order for buffers, RGB565 for fills
+    // Buffer sink
+    uint16_t *buf;
+    int buf_x, buf_y, buf_w;
+    // Fill sink: rectangle still to be sent, none while fill_y1 < fill_y0
+    int fill_x0, fill_x1, fill_y0, fill_y1;
+};
+
+static void span(span_sink_t *s, int x0, int x1, int y) {
+    if (x0 > x1) {
+        int t = x0;
+        x0 = x1;
+        x1 = t;
+    }
+    if (y < s->clip_y0 || y > s->clip_y1) return;
+    if (x0 < s->clip_x0) x0 = s->clip_x0;
+    if (x1 > s->clip_x1) x1 = s->clip_x1;
+    if (x0 > x1) return;
+    s->emit(s, x0, x1, y);
+}
+
+static void emit_buf(span_sink_t *s, int x0, int x1, int y) {
+    uint16_t *dst = s->buf + (y - s->buf_y) * s->buf_w + (x0 - s->buf_x);
+    for (int i = 0; i <= x1 - x0; i++) {
+        dst[i] = s->color;
+    }
+}
+
+static void fill_flush(span_sink_t *s) {
+    if (s->fill_y1 >= s->fill_y0) {
+        clear_region(s->fill_x0, s->fill_y0, s->fill_x1, s->fill_y1, s->color);
+    }
+    s->fill_y1 = s->fill_y0 - 1;
+}
+
+/* Grow the pending rectangle while spans stack straight down. */
+static void emit_fill(span_sink_t *s, int x0, int x1, int y) {
+    if (s->fill_y1 >= s->fill_y0 && x0 == s->fill_x0 && x1 == s->fill_x1 && y == s->fill_y1 + 1) {
+        s->fill_y1 = y;
+        return;
+    }
+    fill_flush(s);
+    s->fill_x0 = x0;
+    s->fill_x1 = x1;
+    s->fill_y0 = s->fill_y1 = y;
+}
+
+/* Bresenham, one span per row: a shallow line is a few long spans, a steep
+ * one a column of single pixels. */
+static void raster_line(span_sink_t *s, int x0, int y0, int x1, int y1) {
+    if (y0 > y1) {
+        int t = x0;
+        x0 = x1;
+        x1 = t;
+        t = y0;
+        y0 = y1;
+        y1 = t;
+    }
+    if (y1 < s->clip_y0 || y0 > s->clip_y1) return;
+
+    int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int dy = y1 - y0;
+    int err = dx - dy;
+    int x = x0, y = y0, run = x0;
+
+    while (x != x1 || y != y1) {
+        int e2 = 2 * err;
+        int nx = x;
+        if (e2 >= -dy) {
+            err -= dy;
+            nx += sx;
+        }
+        if (e2 <= dx) {
+            err += dx;
+            span(s, run, x, y);
+            if (++y > s->clip_y1) return;
+            run = nx;
+        }
+        x = nx;
+    }
+    span(s, run, x, y);
+}
+
+static void raster_polyline(span_sink_t *s, const display_point_t *p, int count, bool closed) {
+    if (count == 1) {
+        span(s, p[0].x, p[0].x, p[0].y);
+    }
+    for (int i = 1; i < count; i++) {
+        raster_line(s, p[i - 1].x, p[i - 1].y, p[i].x, p[i].y);
+    }
+    if (closed && count > 2) {
+        raster_line(s, p[count - 1].x, p[count - 1].y, p[0].x, p[0].y);
+    }
+}
+
+static void round_rows(span_sink_t *s, int x0, int x1, int yt, int yb) {
+    span(s, x0, x1, yt);
+    if (yb != yt) span(s, x0, x1, yb);
+}
+
+/* Rounded box whose corner circles (radius r) are centered on (cxl, cyt),
+ * (cxr, cyt), (cxr, cyb) and (cxl, cyb); a circle has all four at its
+ * center. Row dy away from a center spans x <= xo(dy), the largest x with
+ * x^2 + dy^2 <= r^2 + r (the midpoint criterion). An outline row runs from
+ * xo(dy + 1) + 1 to xo(dy), so the curve stays connected where it is
+ * steep. */
+static void raster_round(span_sink_t *s, int cxl, int cyt, int cxr, int cyb, int r, bool filled) {
+    int rr = r * r + r;
+    int prev = -1;      // xo(dy + 1)
+    int x = 0;
+
+    for (int dy = r; dy >= 0; dy--) {
+        while ((x + 1) * (x + 1) + dy * dy <= rr) {
+            x++;
+        }
+        int in = (prev + 1 < x) ? prev + 1 : x;
+        if (filled || dy == r || cxl - in + 1 >= cxr + in) {
+            round_rows(s, cxl - x, cxr + x, cyt - dy, cyb + dy);
+        } else {
+            round_rows(s, cxl - x, cxl - in, cyt - dy, cyb + dy);
+            round_rows(s, cxr + in, cxr + x, cyt - dy, cyb + dy);
+        }
+        prev = x;
+    }
+
+    // Straight sides, one column at a time so fills can merge them
+    int y0 = cyt + 1 > s->clip_y0 ? cyt + 1 : s->clip_y0;
+    int y1 = cyb - 1 < s->clip_y1 ? cyb - 1 : s->clip_y1;
+    if (filled) {
+        for (int y = y0; y <= y1; y++) span(s, cxl - r, cxr + r, y);
+    } else {
+        for (int y = y0; y <= y1; y++) span(s, cxl - r, cxl - r, y);
+        for (int y = y0; y <= y1; y++) span(s, cxr + r, cxr + r, y);
+    }
+}
+
+static void raster(span_sink_t *s, const display_shape_t *sh) {
+    switch (sh->type) {
+    case DISPLAY_SHAPE_LINE:
+        raster_line(s, sh->x0, sh->y0, sh->x1, sh->y1);
+        break;
+    case DISPLAY_SHAPE_POLYLINE:
+        raster_polyline(s, sh->points, sh->count, sh->closed);
+        break;
+    case DISPLAY_SHAPE_CIRCLE:
+        raster_round(s, sh->x0, sh->y0, sh->x0, sh->y0, sh->r, sh->filled);
+        break;
+    case DISPLAY_SHAPE_ROUND_RECT: {
+        int x0 = sh->x0 < sh->x1 ? sh->x0 : sh->x1;
+        int x1 = sh->x0 < sh->x1 ? sh->x1 : sh->x0;
+        int y0 = sh->y0 < sh->y1 ? sh->y0 : sh->y1;
+        int y1 = sh->y0 < sh->y1 ? sh->y1 : sh->y0;
+        // The corners can't take more than half of either side
+        int r = sh->r;
+        if (r > (x1 - x0) / 2) r = (x1 - x0) / 2;
+        if (r > (y1 - y0) / 2) r = (y1 - y0) / 2;
+        raster_round(s, x0 + r, y0 + r, x1 - r, y1 - r, r, sh->filled);
+        break;
+    }
+    }
+}
+
+display_shape_t display_shape_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    display_shape_t s;
+    memset(&s, 0, sizeof(s));
+    s.type = DISPLAY_SHAPE_LINE;
+    s.color = color;
+    s.x0 = x0;
+    s.y0 = y0;
+    s.x1 = x1;
+    s.y1 = y1;
+    return s;
+}
+
+display_shape_t display_shape_polyline(const display_point_t *points, uint16_t count, bool closed,
+                                       uint16_t color) {
+    display_shape_t s;
+    memset(&s, 0, sizeof(s));
+    s.type = DISPLAY_SHAPE_POLYLINE;
+    s.color = color;
+    s.closed = closed;
+    s.points = points;
+    s.count = count;
+    return s;
+}
+
+display_shape_t display_shape_circle(int16_t cx, int16_t cy, uint16_t r, uint16_t color, bool filled) {
+    display_shape_t s = display_shape_line(cx, cy, cx, cy, color);
+    s.type = DISPLAY_SHAPE_CIRCLE;
+    s.r = r;
+    s.filled = filled;
+    return s;
+}
+
+display_shape_t display_shape_round_rect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t r,
+                                         uint16_t color, bool filled) {
+    display_shape_t s = display_shape_line(x0, y0, x1, y1, color);
+    s.type = DISPLAY_SHAPE_ROUND_RECT;
+    s.r = r;
+    s.filled = filled;
+    return s;
+}
+
+void display_shape_bounds(const display_shape_t *sh, int *x0, int *y0, int *x1, int *y1) {
+    switch (sh->type) {
+    case DISPLAY_SHAPE_POLYLINE:
+        if (sh->count == 0) {
+            *x0 = *y0 = 0;
+            *x1 = *y1 = -1;
+            return;
+        }
+        *x0 = *x1 = sh->points[0].x;
+        *y0 = *y1 = sh->points[0].y;
+        for (int i = 1; i < sh->count; i++) {
+            const display_point_t *p = &sh->points[i];
+            if (p->x < *x0) *x0 = p->x;
+            if (p->x > *x1) *x1 = p->x;
+            if (p->y < *y0) *y0 = p->y;
+            if (p->y > *y1) *y1 = p->y;
+        }
+        return;
+    case DISPLAY_SHAPE_CIRCLE:
+        *x0 = sh->x0 - sh->r;
+        *x1 = sh->x0 + sh->r;
+        *y0 = sh->y0 - sh->r;
+        *y1 = sh->y0 + sh->r;
+        return;
+    default:
+        *x0 = sh->x0 < sh->x1 ? sh->x0 : sh->x1;
+        *x1 = sh->x0 < sh->x1 ? sh->x1 : sh->x0;
+        *y0 = sh->y0 < sh->y1 ? sh->y0 : sh->y1;
+        *y1 = sh->y0 < sh->y1 ? sh->y1 : sh->y0;
+        return;
+    }
+}
+
+void display_shape_render(const display_shape_t *shape, uint16_t *buf, int buf_x, int buf_y, int buf_w, int buf_h) {
+    span_sink_t s = {
+        .emit = emit_buf,
+        .clip_x0 = buf_x,
+        .clip_y0 = buf_y,
+        .clip_x1 = buf_x + buf_w - 1,
+        .clip_y1 = buf_y + buf_h - 1,
+        .color = DISPLAY_SWAP16(shape->color),
+        .buf = buf,
+        .buf_x = buf_x,
+        .buf_y = buf_y,
+        .buf_w = buf_w,
+    };
+    raster(&s, shape);
+}
+
+void draw_shape(const display_shape_t *shape) {
+    span_sink_t s = {
+        .emit = emit_fill,
+        .clip_x1 = display_width() - 1,
+        .clip_y1 = display_height() - 1,
+        .color = shape->color,
+        .fill_y0 = 0,
+        .fill_y1 = -1,
+    };
+    raster(&s, shape);
+    fill_flush(&s);
+}
+
+void draw_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    display_shape_t s = display_shape_line(x0, y0, x1, y1, color);
+    draw_shape(&s);
+}
+
+void draw_polyline(const display_point_t *points, uint16_t count, uint16_t color) {
+    display_shape_t s = display_shape_polyline(points, count, false, color);
+    draw_shape(&s);
+}
+
+void draw_circle(int16_t cx, int16_t cy, uint16_t r, uint16_t color) {
+    display_shape_t s = display_shape_circle(cx, cy, r, color, false);
+    draw_shape(&s);
+}
+
+void fill_circle(int16_t cx, int16_t cy, uint16_t r, uint16_t color) {
+    display_shape_t s = display_shape_circle(cx, cy, r, color, true);
+    draw_shape(&s);
+}
+
+void draw_round_rect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t r, uint16_t color) {
+    display_shape_t s = display_shape_round_rect(x0, y0, x1, y1, r, color, false);
+    draw_shape(&s);
+}
+
+void fill_round_rect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t r, uint16_t color) {
+    display_shape_t s = display_shape_round_rect(x0, y0, x1, y1, r, color, true);
+    draw_shape(&s);
+}
@@ -0,0 +1,69 @@
+#ifndef DISPLAY_SHAPE_H
+#define DISPLAY_SHAPE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Lines, polylines, circles and rounded rectangles, rasterized as
+ * horizontal spans (Bresenham lines, midpoint circles).
+ *
+ * The spans go to one of three places:
+ *  - draw_shape() and the draw_ / fill_ helpers write to the panel at once.
+ *    Spans that continue each other down the screen (vertical lines,
+ *    circle and box sides, filled interiors) merge into one clear_region()
+ *    window, so a pixel costs a window only on diagonals.
+ *  - display_prim_shape() puts a shape into a band display list, where
+ *    spans are plain row fills in the band buffer: the cheapest way to draw
+ *    charts and gauges with many diagonal segments.
+ *  - display_fb_draw_shape() draws into the framebuffer.
+ *
+ * Coordinates are logical and may be partly off screen; shapes are clipped.
+ */
+
+typedef struct {
+    int16_t x, y;
+} display_point_t;
+
+typedef enum {
+    DISPLAY_SHAPE_LINE,         // (x0, y0) to (x1, y1)
+    DISPLAY_SHAPE_POLYLINE,     // points[0..count-1]; closed joins the last to the first
+    DISPLAY_SHAPE_CIRCLE,       // center (x0, y0), radius r
+    DISPLAY_SHAPE_ROUND_RECT,   // corners (x0, y0) and (x1, y1) inclusive, corner radius r
+} display_shape_type_t;
+
+typedef struct {
+    display_shape_type_t type;
+    uint16_t color;             // RGB565
+    bool filled;                // circles and rectangles
+    bool closed;                // polylines
+    int16_t x0, y0, x1, y1;
+    uint16_t r;
+    const display_point_t *points;
+    uint16_t count;
+} display_shape_t;
+
+display_shape_t display_shape_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+display_shape_t display_shape_polyline(const display_point_t *points, uint16_t count, bool closed,
+                                       uint16_t color);
+display_shape_t display_shape_circle(int16_t cx, int16_t cy, uint16_t r, uint16_t color, bool filled);
+display_shape_t display_shape_round_rect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t r,
+                                         uint16_t color, bool filled);
+
+// Inclusive bounding box
+void display_shape_bounds(const display_shape_t *shape, int *x0, int *y0, int *x1, int *y1);
+
+// Rasterize into a panel-order buffer covering the screen rectangle
+// (buf_x, buf_y, buf_w x buf_h), clipped to it.
+void display_shape_render(const display_shape_t *shape, uint16_t *buf, int buf_x, int buf_y, int buf_w, int buf_h);
+
+// Straight to the panel; fills are queued like clear_region().
+void draw_shape(const display_shape_t *shape);
+void draw_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+void draw_polyline(const display_point_t *points, uint16_t count, uint16_t color);
+void draw_circle(int16_t cx, int16_t cy, uint16_t r, uint16_t color);
+void fill_circle(int16_t cx, int16_t cy, uint16_t r, uint16_t color);
+void draw_round_rect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t r, uint16_t color);
+void fill_round_rect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t r, uint16_t color);
+
+#endif
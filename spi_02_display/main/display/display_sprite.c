@@ -0,0 +1,152 @@
+#include "display_sprite.h"
+#include "display_priv.h"
+#include "esp_heap_caps.h"
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SPRITE_BAND_BYTES 4096
+
+// Two pixels in one word, laid out in memory as the panel reads them
+#define PACK2(a, b) ((uint32_t)DISPLAY_SWAP16(a) | ((uint32_t)DISPLAY_SWAP16(b) << 16))
+
+void display_sprite_build_lut(display_sprite_lut_t *lut, const uint16_t *pal, uint8_t bpp) {
+    lut->bpp = bpp;
+    switch (bpp) {
+    case 1:
+        for (int n = 0; n < 16; n++) {
+            lut->px1[n][0] = PACK2(pal[(n >> 3) & 1], pal[(n >> 2) & 1]);
+            lut->px1[n][1] = PACK2(pal[(n >> 1) & 1], pal[n & 1]);
+        }
+        break;
+    case 2:
+        for (int b = 0; b < 256; b++) {
+            lut->px2[b][0] = PACK2(pal[(b >> 6) & 3], pal[(b >> 4) & 3]);
+            lut->px2[b][1] = PACK2(pal[(b >> 2) & 3], pal[b & 3]);
+        }
+        break;
+    case 4:
+        for (int b = 0; b < 256; b++) {
+            lut->px4[b] = PACK2(pal[b >> 4], pal[b & 15]);
+        }
+        break;
+    case 8:
+        for (int b = 0; b < 256; b++) {
+            lut->px8[b] = DISPLAY_SWAP16(pal[b]);
+        }
+        break;
+    }
+}
+
+static int row_bytes(const display_sprite_t *s) {
+    return (s->width * s->bpp + 7) / 8;
+}
+
+int display_sprite_row_pixels(const display_sprite_t *s) {
+    int n = row_bytes(s) * 8 / s->bpp;
+    return (n + 1) & ~1;
+}
+
+void display_sprite_expand_row(const display_sprite_lut_t *lut, const display_sprite_t *s,
+                               int row, uint16_t *dst) {
+    int n = row_bytes(s);
+    const uint8_t *src = s->data + row * n;
+    uint32_t *out = (uint32_t *)dst;
+
+    switch (lut->bpp) {
+    case 1:
+        for (int i = 0; i < n; i++) {
+            const uint32_t *hi = lut->px1[src[i] >> 4];
+            const uint32_t *lo = lut->px1[src[i] & 15];
+            out[0] = hi[0];
+            out[1] = hi[1];
+            out[2] = lo[0];
+            out[3] = lo[1];
+            out += 4;
+        }
+        break;
+    case 2:
+        for (int i = 0; i < n; i++) {
+            out[0] = lut->px2[src[i]][0];
+            out[1] = lut->px2[src[i]][1];
+            out += 2;
+        }
+        break;
+    case 4:
+        for (int i = 0; i < n; i++) {
+            *out++ = lut->px4[src[i]];
+        }
+        break;
+    case 8: {
+        int i = 0;
+        for (; i + 1 < n; i += 2) {
+            *out++ = lut->px8[src[i]] | ((uint32_t)lut->px8[src[i + 1]] << 16);
+        }
+        if (i < n) {
+            *out = lut->px8[src[i]];
+        }
+        break;
+    }
+    }
+}
+
+/* Expand bands of rows into ping-pong DMA buffers, each band going out while
+ * the next one is expanded. Rows land directly in the band when they stay
+ * word aligned (even width); otherwise they go through a scratch row. */
+esp_err_t draw_sprite(uint16_t x0, uint16_t y0, const display_sprite_t *sprite) {
+    if (sprite->bpp != 1 && sprite->bpp != 2 && sprite->bpp != 4 && sprite->bpp != 8) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (sprite->width == 0 || sprite->height == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    display_sprite_lut_t *lut = malloc(sizeof(*lut));
+    if (!lut) {
+        return ESP_ERR_NO_MEM;
+    }
+    display_sprite_build_lut(lut, sprite->palette, sprite->bpp);
+
+    int w = sprite->width;
+    int pad_px = display_sprite_row_pixels(sprite);
+    int band_rows = SPRITE_BAND_BYTES / (w * 2);
+    if (band_rows < 1) band_rows = 1;
+    if (band_rows > sprite->height) band_rows = sprite->height;
+
+    bool direct = (w % 2) == 0;
+    uint16_t *scratch = direct ? NULL : heap_caps_malloc(pad_px * 2, MALLOC_CAP_32BIT);
+    display_pingpong_t pp;
+    // Slack past the last row for the padding pixels of a direct expansion
+    esp_err_t ret = display_pp_init(&pp, band_rows * w * 2 + (pad_px - w) * 2);
+    if (ret == ESP_OK && !direct && !scratch) {
+        display_pp_free(&pp);
+        ret = ESP_ERR_NO_MEM;
+    }
+    if (ret != ESP_OK) {
+        heap_caps_free(scratch);
+        free(lut);
+        return ret;
+    }
+
+    set_window(x0, y0, x0 + w - 1, y0 + sprite->height - 1);
+
+    for (int y = 0; y < sprite->height; y += band_rows) {
+        int rows = (sprite->height - y < band_rows) ? sprite->height - y : band_rows;
+        uint16_t *band = (uint16_t *)display_pp_next(&pp);
+
+        for (int r = 0; r < rows; r++) {
+            if (direct) {
+                display_sprite_expand_row(lut, sprite, y + r, band + r * w);
+            } else {
+                display_sprite_expand_row(lut, sprite, y + r, scratch);
+                memcpy(band + r * w, scratch, w * 2);
+            }
+        }
+        display_pp_submit(&pp, rows * w * 2);
+    }
+
+    display_pp_free(&pp);
+    heap_caps_free(scratch);
+    free(lut);
+    return ESP_OK;
+}
@@ -0,0 +1,48 @@
+#ifndef DISPLAY_SPRITE_H
+#define DISPLAY_SPRITE_H
+
+#include "esp_err.h"
+#include <stdint.h>
+
+/*
+ * Palette-indexed sprites at 1, 2, 4 or 8 bits per pixel.
+ *
+ * Each row starts on a byte boundary and packs pixels MSB first. Palette
+ * entries are plain RGB565 values (not byte-swapped). Rows are expanded
+ * through a lookup table that turns one source byte into whole 32-bit words
+ * of panel-order pixels, so expansion keeps up with the SPI clock.
+ */
+
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    uint8_t bpp;
+    const uint8_t *data;
+    const uint16_t *palette;    // 1 << bpp entries
+} display_sprite_t;
+
+// Expansion table built from a palette for one bit depth
+typedef struct {
+    uint8_t bpp;
+    union {
+        uint32_t px1[16][2];    // 1 bpp: nibble -> 4 pixels
+        uint32_t px2[256][2];   // 2 bpp: byte -> 4 pixels
+        uint32_t px4[256];      // 4 bpp: byte -> 2 pixels
+        uint16_t px8[256];      // 8 bpp: byte -> 1 pixel
+    };
+} display_sprite_lut_t;
+
+void display_sprite_build_lut(display_sprite_lut_t *lut, const uint16_t *palette, uint8_t bpp);
+
+// Pixels display_sprite_expand_row() may write for one row: the width
+// rounded up to a whole source byte (and to an even count).
+int display_sprite_row_pixels(const display_sprite_t *sprite);
+
+// Expand one row into dst, which must be 4-byte aligned and hold
+// display_sprite_row_pixels() pixels.
+void display_sprite_expand_row(const display_sprite_lut_t *lut, const display_sprite_t *sprite,
+                               int row, uint16_t *dst);
+
+esp_err_t draw_sprite(uint16_t x0, uint16_t y0, const display_sprite_t *sprite);
+
+#endif
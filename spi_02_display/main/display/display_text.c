@@ -0,0 +1,229 @@
+#include "display_font.h"
+#include "display_priv.h"
+#include "esp_heap_caps.h"
+#include <string.h>
+
+// RAM cache of glyphs as coverage runs: one byte per run, coverage in the
+// high nibble and length - 1 in the low nibble. Runs continue across rows
+// of the ink box. Glyphs whose runs don't fit a slot are drawn straight
+// from the atlas.
+#define GLYPH_CACHE_SLOTS 32
+#define GLYPH_CACHE_BYTES 120
+
+typedef struct {
+    const display_font_t *font;
+    uint16_t index;             // into font->glyphs, after the '?' fallback
+    uint8_t len;
+    uint32_t last_used;
+    uint8_t runs[GLYPH_CACHE_BYTES];
+} glyph_slot_t;
+
+static glyph_slot_t glyph_cache[GLYPH_CACHE_SLOTS];
+static uint32_t glyph_clock;
+
+static uint16_t *text_buf;      // DMA band reused by draw_text()
+static int text_buf_pixels;
+static uint32_t text_seq;
+static display_t *text_disp;    // the display text_seq counts on
+
+static const display_glyph_t *find_glyph(const display_font_t *font, char c) {
+    unsigned idx = (uint8_t)c - font->first;
+    if (idx >= font->count) {
+        idx = '?' - font->first;
+        if (idx >= font->count) return NULL;
+    }
+    return &font->glyphs[idx];
+}
+
+static int coverage_at(const display_font_t *font, const display_glyph_t *g, int px, int py) {
+    const uint8_t *row = font->bitmap + g->offset + py * ((g->width + 1) / 2);
+    uint8_t b = row[px / 2];
+    return (px & 1) ? (b & 0x0F) : (b >> 4);
+}
+
+/* Returns the number of run bytes, or -1 if they don't fit in max. */
+static int encode_runs(const display_font_t *font, const display_glyph_t *g, uint8_t *out, int max) {
+    int len = 0;
+    int total = g->width * g->height;
+    int i = 0;
+
+    while (i < total) {
+        int a = coverage_at(font, g, i % g->width, i / g->width);
+        int n = 1;
+        while (n < 16 && i + n < total &&
+               coverage_at(font, g, (i + n) % g->width, (i + n) / g->width) == a) {
+            n++;
+        }
+        if (len == max) return -1;
+        out[len++] = (a << 4) | (n - 1);
+        i += n;
+    }
+    return len;
+}
+
+static const glyph_slot_t *cache_lookup(const display_font_t *font, const display_glyph_t *g) {
+    uint16_t index = g - font->glyphs;
+    glyph_slot_t *victim = &glyph_cache[0];
+    glyph_clock++;
+
+    for (int i = 0; i < GLYPH_CACHE_SLOTS; i++) {
+        glyph_slot_t *s = &glyph_cache[i];
+        if (s->font == font && s->index == index) {
+            s->last_used = glyph_clock;
+            return s;
+        }
+        if (s->last_used < victim->last_used) {
+            victim = s;
+        }
+    }
+
+    // Encode aside first: a glyph too big for a slot must not evict one
+    uint8_t runs[GLYPH_CACHE_BYTES];
+    int len = encode_runs(font, g, runs, GLYPH_CACHE_BYTES);
+    if (len < 0) {
+        return NULL;
+    }
+    memcpy(victim->runs, runs, len);
+    victim->font = font;
+    victim->index = index;
+    victim->len = len;
+    victim->last_used = glyph_clock;
+    return victim;
+}
+
+/* fg over a panel-order pixel at coverage a (0..15), result in panel order. */
+static uint16_t blend_over(uint16_t dst, uint16_t fg, int a) {
+    uint16_t bg = DISPLAY_SWAP16(dst);
+    int r = (bg >> 11) + ((fg >> 11) - (bg >> 11)) * a / 15;
+    int g = ((bg >> 5) & 0x3F) + (((fg >> 5) & 0x3F) - ((bg >> 5) & 0x3F)) * a / 15;
+    int b = (bg & 0x1F) + ((fg & 0x1F) - (bg & 0x1F)) * a / 15;
+    return DISPLAY_SWAP16((uint16_t)((r << 11) | (g << 5) | b));
+}
+
+static inline void plot(uint16_t *dst, int a, uint16_t fg, const uint16_t *ramp) {
+    *dst = ramp ? ramp[a] : blend_over(*dst, fg, a);
+}
+
+/* Draw one glyph whose ink box starts at (gx, gy) in buffer coordinates. */
+static void render_glyph(const display_font_t *font, const display_glyph_t *g, const glyph_slot_t *slot,
+                         int gx, int gy, uint16_t fg, const uint16_t *ramp,
+                         uint16_t *buf, int buf_w, int buf_h) {
+    if (slot) {
+        int col = 0, row = 0;
+        for (int r = 0; r < slot->len; r++) {
+            int a = slot->runs[r] >> 4;
+            int n = (slot->runs[r] & 0x0F) + 1;
+            while (n > 0) {
+                int seg = (n < g->width - col) ? n : g->width - col;
+                int y = gy + row;
+                if (a && y >= 0 && y < buf_h) {
+                    int x0 = gx + col, x1 = gx + col + seg;
+                    if (x0 < 0) x0 = 0;
+                    if (x1 > buf_w) x1 = buf_w;
+                    uint16_t *dst = buf + y * buf_w;
+                    for (int x = x0; x < x1; x++) {
+                        plot(&dst[x], a, fg, ramp);
+                    }
+                }
+                col += seg;
+                n -= seg;
+                if (col == g->width) {
+                    col = 0;
+                    row++;
+                }
+            }
+        }
+        return;
+    }
+
+    for (int py = 0; py < g->height; py++) {
+        int y = gy + py;
+        if (y < 0 || y >= buf_h) continue;
+        for (int px = 0; px < g->width; px++) {
+            int x = gx + px;
+            int a = coverage_at(font, g, px, py);
+            if (a && x >= 0 && x < buf_w) {
+                plot(&buf[y * buf_w + x], a, fg, ramp);
+            }
+        }
+    }
+}
+
+int display_text_width(const display_font_t *font, const char *str) {
+    int w = 0;
+    for (; *str; str++) {
+        const display_glyph_t *g = find_glyph(font, *str);
+        if (g) w += g->advance;
+    }
+    return w;
+}
+
+void display_text_ramp(uint16_t ramp[16], uint16_t fg, uint16_t bg) {
+    int fr = fg >> 11, fgn = (fg >> 5) & 0x3F, fb = fg & 0x1F;
+    int br = bg >> 11, bgn = (bg >> 5) & 0x3F, bb = bg & 0x1F;
+
+    for (int a = 0; a < 16; a++) {
+        int r = br + (fr - br) * a / 15;
+        int g = bgn + (fgn - bgn) * a / 15;
+        int b = bb + (fb - bb) * a / 15;
+        ramp[a] = DISPLAY_SWAP16((uint16_t)((r << 11) | (g << 5) | b));
+    }
+}
+
+void display_text_render(const display_font_t *font, const char *str, int x, int y,
+                         uint16_t fg, const uint16_t ramp[16], uint16_t *buf,
+                         int buf_x, int buf_y, int buf_w, int buf_h) {
+    int pen = x - buf_x;
+    int top = y - buf_y;
+
+    for (; *str && pen < buf_w; str++) {
+        const display_glyph_t *g = find_glyph(font, *str);
+        if (!g) continue;
+        int gy = top + g->y_ofs;
+        if (g->width && pen + g->x_ofs + g->width > 0 && gy + g->height > 0 && gy < buf_h) {
+            const glyph_slot_t *slot = cache_lookup(font, g);
+            render_glyph(font, g, slot, pen + g->x_ofs, gy, fg, ramp, buf, buf_w, buf_h);
+        }
+        pen += g->advance;
+    }
+}
+
+esp_err_t draw_text(uint16_t x, uint16_t y, const char *str, const display_font_t *font,
+                    uint16_t fg, uint16_t bg) {
+    if (x >= display_width() || y >= display_height()) return ESP_ERR_INVALID_ARG;
+
+    int w = display_text_width(font, str);
+    int h = font->line_height;
+    if (w > display_width() - x) w = display_width() - x;
+    if (h > display_height() - y) h = display_height() - y;
+    if (w == 0) return ESP_OK;
+
+    // The previous string may still be on the wire, maybe to another panel
+    display_t *disp = display_selected();
+    if (text_disp && text_disp != disp) {
+        display_select(text_disp);
+        display_wait_done();
+        display_select(disp);
+    } else {
+        display_wait_seq(text_seq);
+    }
+    if (text_buf_pixels < w * h) {
+        heap_caps_free(text_buf);
+        text_buf = heap_caps_malloc(w * h * 2, MALLOC_CAP_DMA);
+        text_buf_pixels = text_buf ? w * h : 0;
+        if (!text_buf) return ESP_ERR_NO_MEM;
+    }
+
+    uint16_t ramp[16];
+    display_text_ramp(ramp, fg, bg);
+    for (int i = 0; i < w * h; i++) {
+        text_buf[i] = ramp[0];
+    }
+    display_text_render(font, str, x, y, fg, ramp, text_buf, x, y, w, h);
+
+    set_window(x, y, x + w - 1, y + h - 1);
+    display_queue_data(text_buf, w * h * 2, NULL, NULL);
+    text_seq = display_trans_seq();
+    text_disp = disp;
+    return ESP_OK;
+}
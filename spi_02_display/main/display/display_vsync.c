@@ -0,0 +1,143 @@
+#include "display.h"
+#include "display_priv.h"
+#include "display_bus.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "esp_attr.h"
+
+// V-blank edges are counted in the selected panel's display_t, see
+// display_vsync_state_t. The ISR gets that panel's state as its argument.
+
+static void IRAM_ATTR te_isr(void *arg) {
+    display_vsync_state_t *v = arg;
+    BaseType_t woken = pdFALSE;
+    v->count++;
+    xSemaphoreGiveFromISR(v->sem, &woken);
+    if (woken) portYIELD_FROM_ISR(woken);
+}
+
+/* Listen to the TE pin and turn the panel's tearing-effect output on
+ * (TEON, V-blank only). The rising edge marks the start of V-blank. */
+esp_err_t display_te_enable(void) {
+    display_vsync_state_t *v = display_vsync_state();
+    if (v->enabled) return ESP_OK;
+
+    if (!v->sem) {
+        v->sem = xSemaphoreCreateBinary();
+        if (!v->sem) return ESP_ERR_NO_MEM;
+    }
+
+    esp_err_t ret = display_bus()->te_attach(display_bus_dev(), te_isr, v);
+    if (ret != ESP_OK) return ret;
+
+    send_cmd(0x35);
+    send_data((const uint8_t[]){0x00}, 1);
+    v->enabled = true;
+    return ESP_OK;
+}
+
+void display_te_disable(void) {
+    display_vsync_state_t *v = display_vsync_state();
+    if (!v->enabled) return;
+    send_cmd(0x34);
+    display_bus()->te_attach(display_bus_dev(), NULL, NULL);
+    v->enabled = false;
+}
+
+bool display_te_enabled(void) {
+    return display_vsync_state()->enabled;
+}
+
+/* Block until the next V-blank edge. */
+esp_err_t display_wait_vsync(TickType_t timeout) {
+    display_vsync_state_t *v = display_vsync_state();
+    if (!v->enabled) return ESP_ERR_INVALID_STATE;
+    xSemaphoreTake(v->sem, 0);      // drop an edge that fired before the call
+    return xSemaphoreTake(v->sem, timeout) == pdTRUE ? ESP_OK : ESP_ERR_TIMEOUT;
+}
+
+/* Program FRMCTR1 (0xB1) with the divider/line-period pair closest to hz.
+ * Returns the refresh rate actually set. */
+int display_set_frame_rate(int hz) {
+    int best_diva = 0, best_rtna = 0x18, best_err = -1;
+
+    for (int diva = 0; diva < 4; diva++) {
+        for (int rtna = 0x10; rtna <= 0x1F; rtna++) {
+            int f = DISPLAY_FRC_FOSC_HZ / ((rtna << diva) * DISPLAY_FRC_LINES);
+            int err = f > hz ? f - hz : hz - f;
+            if (best_err < 0 || err < best_err) {
+                best_err = err;
+                best_diva = diva;
+                best_rtna = rtna;
+            }
+        }
+    }
+
+    uint8_t frc[] = {best_diva, best_rtna};
+    send_cmd(0xB1);
+    send_data(frc, sizeof(frc));
+    display_vsync_state_t *v = display_vsync_state();
+    v->refresh_hz = DISPLAY_FRC_FOSC_HZ / ((best_rtna << best_diva) * DISPLAY_FRC_LINES);
+    return v->refresh_hz;
+}
+
+int display_get_frame_rate(void) {
+    return display_vsync_state()->refresh_hz;
+}
+
+static int64_t pacer_period_us(const display_pacer_t *pacer, const display_vsync_state_t *v) {
+    return (1000000LL * pacer->interval + v->refresh_hz / 2) / v->refresh_hz;
+}
+
+/* Frame scheduler: releases the caller every 'interval' panel refreshes,
+ * on the V-blank edge when TE is enabled, on a timer otherwise. A frame
+ * that arrives after its slot counts as missed and is realigned to the
+ * next one. The timer slots are kept in microseconds and only the sleep
+ * is rounded to ticks, so the rate does not drift to a whole tick count. */
+void display_pacer_init(display_pacer_t *pacer, int target_fps) {
+    const display_vsync_state_t *v = display_vsync_state();
+    int interval = (v->refresh_hz + target_fps / 2) / target_fps;
+    pacer->interval = interval < 1 ? 1 : interval;
+    pacer->frames = 0;
+    pacer->missed = 0;
+    pacer->start_us = esp_timer_get_time();
+    pacer->next_vsync = v->count + pacer->interval;
+    pacer->next_us = pacer->start_us + pacer_period_us(pacer, v);
+}
+
+void display_pacer_wait(display_pacer_t *pacer) {
+    display_vsync_state_t *v = display_vsync_state();
+    if (v->enabled) {
+        if ((int32_t)(v->count - pacer->next_vsync) > 0) {
+            pacer->missed++;
+            pacer->next_vsync = v->count + 1;
+        }
+        // No draining here: an edge between reading the count and
+        // blocking must still wake us, and a stale give only costs one
+        // more look at the count.
+        while ((int32_t)(v->count - pacer->next_vsync) < 0) {
+            if (xSemaphoreTake(v->sem, pdMS_TO_TICKS(100)) != pdTRUE) break;
+        }
+        pacer->next_vsync += pacer->interval;
+    } else {
+        int64_t period = pacer_period_us(pacer, v);
+        int64_t now = esp_timer_get_time();
+        if (now > pacer->next_us) {
+            pacer->missed++;
+            pacer->next_us = now + period;
+        }
+        // Sleep to the nearest tick of the slot; an early wake is made up
+        // by the next slot, which stays on the microsecond grid.
+        const int64_t tick_us = portTICK_PERIOD_MS * 1000;
+        TickType_t ticks = (pacer->next_us - now + tick_us / 2) / tick_us;
+        if (ticks > 0) vTaskDelay(ticks);
+        pacer->next_us += period;
+    }
+    pacer->frames++;
+}
+
+float display_pacer_fps(const display_pacer_t *pacer) {
+    int64_t elapsed = esp_timer_get_time() - pacer->start_us;
+    return elapsed > 0 ? pacer->frames * 1000000.0f / elapsed : 0.0f;
+}
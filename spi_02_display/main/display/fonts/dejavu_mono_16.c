@@ -0,0 +1,371 @@
+// Generated by tools/font2atlas.py from DejaVuSansMono.ttf at 16 px. Do not edit.
+#include "display_font.h"
+
+static const uint8_t bitmap[4130] = {
+    0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xe9, 0xd8, 0xc7, 0x00, 0x00, 0xf9, 0xf9, 0x5f, 0x05, 0xf0, 0x5f,
+    0x05, 0xf0, 0x5f, 0x05, 0xf0, 0x5f, 0x05, 0xf0, 0x00, 0x01, 0xf3, 0x0d, 0x60, 0x00, 0x05, 0xe0,
+    0x2f, 0x20, 0x00, 0x09, 0xa0, 0x6d, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xf9, 0x00, 0x2f, 0x20, 0xe4,
+    0x00, 0x00, 0x5e, 0x02, 0xf1, 0x00, 0x00, 0x8b, 0x06, 0xd0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xb0,
+    0x02, 0xf2, 0x0e, 0x50, 0x00, 0x06, 0xd0, 0x3f, 0x10, 0x00, 0x0a, 0x90, 0x7c, 0x00, 0x00, 0x00,
+    0x06, 0x60, 0x00, 0x00, 0x06, 0x60, 0x00, 0x04, 0xbe, 0xea, 0x40, 0x3f, 0x76, 0x74, 0xb0, 0x7e,
+    0x06, 0x60, 0x00, 0x6f, 0x36, 0x60, 0x00, 0x0b, 0xfd, 0xa4, 0x00, 0x00, 0x4a, 0xdf, 0xb1, 0x00,
+    0x06, 0x62, 0xe8, 0x00, 0x06, 0x60, 0xca, 0x78, 0x36, 0x75, 0xf5, 0x17, 0xce, 0xec, 0x50, 0x00,
+    0x06, 0x60, 0x00, 0x00, 0x06, 0x60, 0x00, 0x09, 0xec, 0x40, 0x00, 0x00, 0x7b, 0x14, 0xe1, 0x00,
+    0x00, 0xa5, 0x00, 0xd3, 0x00, 0x00, 0x7b, 0x14, 0xe1, 0x00, 0x30, 0x09, 0xed, 0x40, 0x4b, 0xa0,
+    0x00, 0x00, 0x5c, 0x92, 0x00, 0x00, 0x5c, 0x92, 0x00, 0x00, 0x2c, 0x82, 0x08, 0xed, 0x50, 0x01,
+    0x00, 0x5c, 0x13, 0xe2, 0x00, 0x00, 0x87, 0x00, 0xb5, 0x00, 0x00, 0x5c, 0x13, 0xe2, 0x00, 0x00,
+    0x08, 0xed, 0x50, 0x00, 0x3c, 0xef, 0xc0, 0x00, 0x00, 0xe9, 0x10, 0x00, 0x00, 0x02, 0xf4, 0x00,
+    0x00, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x30, 0x00, 0x00, 0x06, 0xfd, 0xd1, 0x00,
+    0x00, 0x2f, 0x62, 0xe9, 0x00, 0xd5, 0x7e, 0x00, 0x6f, 0x50, 0xe4, 0x8d, 0x00, 0x0a, 0xe4, 0xf1,
+    0x5f, 0x30, 0x01, 0xde, 0xa0, 0x0c, 0xd4, 0x13, 0xbf, 0x70, 0x01, 0x9e, 0xfd, 0x78, 0xf3, 0xd7,
+    0xd7, 0xd7, 0xd7, 0x00, 0x9a, 0x03, 0xf2, 0x0a, 0xb0, 0x1f, 0x60, 0x5f, 0x20, 0x8f, 0x00, 0x9d,
+    0x00, 0xad, 0x00, 0x8f, 0x00, 0x5f, 0x20, 0x1f, 0x60, 0x0a, 0xb0, 0x03, 0xf2, 0x00, 0x9a, 0x1e,
+    0x40, 0x00, 0x08, 0xc0, 0x00, 0x02, 0xf4, 0x00, 0x00, 0xba, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x5f,
+    0x30, 0x00, 0x4f, 0x40, 0x00, 0x4f, 0x40, 0x00, 0x5f, 0x30, 0x00, 0x8e, 0x00, 0x00, 0xba, 0x00,
+    0x02, 0xf4, 0x00, 0x08, 0xc0, 0x00, 0x1e, 0x40, 0x00, 0x00, 0x09, 0x40, 0x00, 0x00, 0x09, 0x40,
+    0x00, 0x69, 0x29, 0x44, 0xb2, 0x04, 0xad, 0xc8, 0x20, 0x04, 0xad, 0xc8, 0x10, 0x69, 0x29, 0x44,
+    0xb2, 0x00, 0x09, 0x40, 0x00, 0x00, 0x09, 0x40, 0x00, 0x00, 0x00, 0xd7, 0x00, 0x00, 0x00, 0x00,
+    0xd7, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0xd7,
+    0x00, 0x00, 0x00, 0x00, 0xd7, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x00, 0x00, 0x1f, 0xd0, 0x1f, 0xd0,
+    0x4f, 0x80, 0x7f, 0x10, 0xb9, 0x00, 0x3f, 0xff, 0xd0, 0x3f, 0xc0, 0x3f, 0xc0, 0x00, 0x00, 0x00,
+    0x4f, 0x30, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x03, 0xf4, 0x00, 0x00, 0x00, 0x0b, 0xc0,
+    0x00, 0x00, 0x00, 0x3f, 0x50, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0x02, 0xf5, 0x00, 0x00,
+    0x00, 0x09, 0xd0, 0x00, 0x00, 0x00, 0x1f, 0x60, 0x00, 0x00, 0x00, 0x8e, 0x10, 0x00, 0x00, 0x01,
+    0xe7, 0x00, 0x00, 0x00, 0x07, 0xe1, 0x00, 0x00, 0x00, 0x1e, 0x80, 0x00, 0x00, 0x00, 0x02, 0xbe,
+    0xe8, 0x00, 0x1d, 0xa1, 0x3e, 0x90, 0x7f, 0x10, 0x07, 0xf1, 0xbc, 0x00, 0x03, 0xf5, 0xda, 0x00,
+    0x01, 0xf8, 0xea, 0x1d, 0x90, 0xf9, 0xea, 0x1e, 0x90, 0xf9, 0xda, 0x00, 0x01, 0xf8, 0xbc, 0x00,
+    0x03, 0xf5, 0x7f, 0x10, 0x07, 0xf1, 0x1d, 0xa1, 0x3e, 0x90, 0x02, 0xbe, 0xe8, 0x00, 0x03, 0x9e,
+    0xf2, 0x00, 0x1c, 0x67, 0xf2, 0x00, 0x00, 0x07, 0xf2, 0x00, 0x00, 0x07, 0xf2, 0x00, 0x00, 0x07,
+    0xf2, 0x00, 0x00, 0x07, 0xf2, 0x00, 0x00, 0x07, 0xf2, 0x00, 0x00, 0x07, 0xf2, 0x00, 0x00, 0x07,
+    0xf2, 0x00, 0x00, 0x07, 0xf2, 0x00, 0x00, 0x07, 0xf2, 0x00, 0x0d, 0xff, 0xff, 0xf8, 0x29, 0xde,
+    0xc6, 0x00, 0xbc, 0x41, 0x4e, 0x90, 0x71, 0x00, 0x08, 0xf1, 0x00, 0x00, 0x07, 0xf3, 0x00, 0x00,
+    0x0a, 0xf1, 0x00, 0x00, 0x4f, 0x90, 0x00, 0x01, 0xdd, 0x10, 0x00, 0x0b, 0xe2, 0x00, 0x00, 0xae,
+    0x30, 0x00, 0x08, 0xf5, 0x00, 0x00, 0x6f, 0x60, 0x00, 0x00, 0xcf, 0xff, 0xff, 0xf4, 0x17, 0xce,
+    0xd7, 0x10, 0x77, 0x21, 0x4e, 0xa0, 0x00, 0x00, 0x08, 0xf1, 0x00, 0x00, 0x07, 0xf1, 0x00, 0x00,
+    0x4e, 0xa0, 0x00, 0xef, 0xfa, 0x00, 0x00, 0x01, 0x4e, 0xa0, 0x00, 0x00, 0x05, 0xf4, 0x00, 0x00,
+    0x03, 0xf6, 0x00, 0x00, 0x05, 0xf4, 0xb5, 0x21, 0x4d, 0xc0, 0x3a, 0xde, 0xd8, 0x10, 0x00, 0x00,
+    0x0c, 0xf5, 0x00, 0x00, 0x00, 0x7e, 0xf5, 0x00, 0x00, 0x02, 0xe7, 0xf5, 0x00, 0x00, 0x0b, 0x94,
+    0xf5, 0x00, 0x00, 0x5e, 0x14, 0xf5, 0x00, 0x01, 0xe7, 0x04, 0xf5, 0x00, 0x09, 0xd0, 0x04, 0xf5,
+    0x00, 0x2f, 0x50, 0x04, 0xf5, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xd0, 0x00, 0x00, 0x04, 0xf5, 0x00,
+    0x00, 0x00, 0x04, 0xf5, 0x00, 0x00, 0x00, 0x04, 0xf5, 0x00, 0x6f, 0xff, 0xff, 0x80, 0x6f, 0x10,
+    0x00, 0x00, 0x6f, 0x10, 0x00, 0x00, 0x6f, 0x10, 0x00, 0x00, 0x6f, 0xef, 0xd7, 0x00, 0x57, 0x11,
+    0x7f, 0x90, 0x00, 0x00, 0x09, 0xf2, 0x00, 0x00, 0x05, 0xf5, 0x00, 0x00, 0x05, 0xf5, 0x00, 0x00,
+    0x08, 0xf2, 0xa5, 0x11, 0x6f, 0x90, 0x3b, 0xef, 0xd7, 0x00, 0x01, 0x8d, 0xfb, 0x30, 0x0b, 0xc3,
+    0x03, 0x80, 0x5f, 0x20, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00, 0xd9, 0x8e, 0xeb, 0x20, 0xee, 0xa1,
+    0x2b, 0xd0, 0xee, 0x10, 0x03, 0xf6, 0xdc, 0x00, 0x00, 0xf8, 0xbc, 0x00, 0x00, 0xf8, 0x7e, 0x10,
+    0x03, 0xf5, 0x1e, 0xa1, 0x2b, 0xd0, 0x03, 0xbe, 0xeb, 0x20, 0xef, 0xff, 0xff, 0xf6, 0x00, 0x00,
+    0x08, 0xf2, 0x00, 0x00, 0x0d, 0xc0, 0x00, 0x00, 0x4f, 0x60, 0x00, 0x00, 0x9f, 0x10, 0x00, 0x01,
+    0xea, 0x00, 0x00, 0x05, 0xf4, 0x00, 0x00, 0x0b, 0xe0, 0x00, 0x00, 0x2f, 0x80, 0x00, 0x00, 0x7f,
+    0x30, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x03, 0xf7, 0x00, 0x00, 0x05, 0xce, 0xea, 0x20, 0x4f, 0x81,
+    0x2c, 0xd1, 0x9e, 0x00, 0x05, 0xf4, 0x9e, 0x00, 0x05, 0xf4, 0x3e, 0x71, 0x2c, 0xb0, 0x04, 0xef,
+    0xfb, 0x10, 0x4f, 0x71, 0x2b, 0xc1, 0xcc, 0x00, 0x02, 0xf6, 0xea, 0x00, 0x00, 0xf9, 0xcc, 0x00,
+    0x02, 0xf7, 0x6f, 0x71, 0x2b, 0xe2, 0x06, 0xce, 0xea, 0x20, 0x06, 0xdf, 0xd8, 0x00, 0x5f, 0x61,
+    0x4e, 0x90, 0xcc, 0x00, 0x07, 0xf1, 0xe9, 0x00, 0x04, 0xf5, 0xe9, 0x00, 0x04, 0xf7, 0xcc, 0x00,
+    0x07, 0xf8, 0x5f, 0x61, 0x4d, 0xf8, 0x06, 0xdf, 0xd4, 0xe7, 0x00, 0x00, 0x02, 0xf4, 0x00, 0x00,
+    0x07, 0xe0, 0x28, 0x21, 0x6f, 0x50, 0x07, 0xde, 0xc5, 0x00, 0x3f, 0xc0, 0x3f, 0xc0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xd0, 0x1f, 0xd0, 0x4f, 0x80, 0x7f, 0x10, 0xb9, 0x00,
+    0x00, 0x00, 0x00, 0x16, 0xc0, 0x00, 0x00, 0x39, 0xee, 0x90, 0x01, 0x6c, 0xfc, 0x61, 0x00, 0x3e,
+    0xe8, 0x30, 0x00, 0x00, 0x3e, 0xe8, 0x20, 0x00, 0x00, 0x01, 0x6c, 0xfc, 0x61, 0x00, 0x00, 0x00,
+    0x39, 0xee, 0x90, 0x00, 0x00, 0x00, 0x16, 0xc0, 0x5f, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xe0, 0x4a, 0x40, 0x00, 0x00,
+    0x00, 0x2c, 0xfd, 0x71, 0x00, 0x00, 0x00, 0x28, 0xef, 0xa4, 0x00, 0x00, 0x00, 0x05, 0xaf, 0xc0,
+    0x00, 0x00, 0x04, 0xaf, 0xc0, 0x00, 0x28, 0xef, 0xa4, 0x00, 0x2c, 0xfd, 0x71, 0x00, 0x00, 0x4a,
+    0x40, 0x00, 0x00, 0x00, 0x04, 0xbe, 0xea, 0x20, 0x1a, 0x41, 0x3d, 0xc0, 0x00, 0x00, 0x08, 0xf1,
+    0x00, 0x00, 0x0b, 0xe0, 0x00, 0x00, 0x9f, 0x50, 0x00, 0x06, 0xf6, 0x00, 0x00, 0x0e, 0x90, 0x00,
+    0x00, 0x2f, 0x60, 0x00, 0x00, 0x2f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x60, 0x00,
+    0x00, 0x3f, 0x60, 0x00, 0x00, 0x18, 0xdf, 0xd7, 0x00, 0x01, 0xda, 0x30, 0x3c, 0x90, 0x0a, 0xa0,
+    0x00, 0x02, 0xf1, 0x3e, 0x10, 0x5d, 0xe8, 0xe3, 0x7a, 0x02, 0xf5, 0x1a, 0xf3, 0xa7, 0x08, 0xa0,
+    0x02, 0xf3, 0xb6, 0x0b, 0x70, 0x00, 0xe3, 0xb6, 0x0b, 0x70, 0x00, 0xe3, 0xa8, 0x08, 0xa0, 0x02,
+    0xf3, 0x7b, 0x02, 0xe5, 0x1a, 0xf3, 0x2f, 0x20, 0x5d, 0xe8, 0xe3, 0x08, 0xc1, 0x00, 0x00, 0x00,
+    0x00, 0xac, 0x41, 0x00, 0x00, 0x00, 0x05, 0xbe, 0xfc, 0x10, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x00,
+    0x09, 0xef, 0x30, 0x00, 0x00, 0x0d, 0x9e, 0x80, 0x00, 0x00, 0x3f, 0x5a, 0xc0, 0x00, 0x00, 0x7f,
+    0x16, 0xf2, 0x00, 0x00, 0xcc, 0x02, 0xf6, 0x00, 0x01, 0xf8, 0x00, 0xeb, 0x00, 0x06, 0xf4, 0x00,
+    0xaf, 0x10, 0x0a, 0xff, 0xff, 0xff, 0x50, 0x0e, 0x90, 0x00, 0x1e, 0x90, 0x4f, 0x50, 0x00, 0x0b,
+    0xd0, 0x8f, 0x10, 0x00, 0x06, 0xf3, 0xbf, 0xff, 0xeb, 0x30, 0xbd, 0x00, 0x2a, 0xe2, 0xbd, 0x00,
+    0x03, 0xf6, 0xbd, 0x00, 0x03, 0xf6, 0xbd, 0x00, 0x2b, 0xe2, 0xbf, 0xff, 0xfd, 0x40, 0xbd, 0x00,
+    0x29, 0xe3, 0xbd, 0x00, 0x00, 0xda, 0xbd, 0x00, 0x00, 0xbd, 0xbd, 0x00, 0x00, 0xdc, 0xbd, 0x00,
+    0x18, 0xf6, 0xbf, 0xff, 0xec, 0x50, 0x00, 0x6c, 0xed, 0x81, 0x08, 0xe5, 0x13, 0xc6, 0x3f, 0x60,
+    0x00, 0x14, 0x9f, 0x10, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0xdb, 0x00,
+    0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x9f, 0x10, 0x00, 0x00, 0x3f, 0x60, 0x00, 0x14, 0x09, 0xe5,
+    0x13, 0xc6, 0x00, 0x6c, 0xfd, 0x81, 0xef, 0xfe, 0xa4, 0x00, 0xea, 0x02, 0x8f, 0x50, 0xea, 0x00,
+    0x09, 0xe1, 0xea, 0x00, 0x04, 0xf5, 0xea, 0x00, 0x01, 0xf8, 0xea, 0x00, 0x01, 0xf9, 0xea, 0x00,
+    0x00, 0xf9, 0xea, 0x00, 0x01, 0xf8, 0xea, 0x00, 0x04, 0xf5, 0xea, 0x00, 0x09, 0xe1, 0xea, 0x02,
+    0x8f, 0x50, 0xef, 0xfe, 0xa4, 0x00, 0x7f, 0xff, 0xff, 0xf7, 0x7f, 0x20, 0x00, 0x00, 0x7f, 0x20,
+    0x00, 0x00, 0x7f, 0x20, 0x00, 0x00, 0x7f, 0x20, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xf4, 0x7f, 0x20,
+    0x00, 0x00, 0x7f, 0x20, 0x00, 0x00, 0x7f, 0x20, 0x00, 0x00, 0x7f, 0x20, 0x00, 0x00, 0x7f, 0x20,
+    0x00, 0x00, 0x7f, 0xff, 0xff, 0xf9, 0x3f, 0xff, 0xff, 0xfa, 0x3f, 0x60, 0x00, 0x00, 0x3f, 0x60,
+    0x00, 0x00, 0x3f, 0x60, 0x00, 0x00, 0x3f, 0x60, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xf3, 0x3f, 0x60,
+    0x00, 0x00, 0x3f, 0x60, 0x00, 0x00, 0x3f, 0x60, 0x00, 0x00, 0x3f, 0x60, 0x00, 0x00, 0x3f, 0x60,
+    0x00, 0x00, 0x3f, 0x60, 0x00, 0x00, 0x00, 0x18, 0xdf, 0xc6, 0x00, 0x00, 0xcc, 0x30, 0x4d, 0x40,
+    0x07, 0xf2, 0x00, 0x02, 0x30, 0x0d, 0xb0, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x3f,
+    0x70, 0x00, 0x00, 0x00, 0x3f, 0x70, 0x09, 0xff, 0x90, 0x1f, 0x80, 0x00, 0x0d, 0x90, 0x0d, 0xb0,
+    0x00, 0x0d, 0x90, 0x08, 0xf2, 0x00, 0x0d, 0x90, 0x01, 0xcc, 0x30, 0x3e, 0x90, 0x00, 0x18, 0xdf,
+    0xd9, 0x20, 0xea, 0x00, 0x00, 0xf8, 0xea, 0x00, 0x00, 0xf8, 0xea, 0x00, 0x00, 0xf8, 0xea, 0x00,
+    0x00, 0xf8, 0xea, 0x00, 0x00, 0xf8, 0xef, 0xff, 0xff, 0xf8, 0xea, 0x00, 0x00, 0xf8, 0xea, 0x00,
+    0x00, 0xf8, 0xea, 0x00, 0x00, 0xf8, 0xea, 0x00, 0x00, 0xf8, 0xea, 0x00, 0x00, 0xf8, 0xea, 0x00,
+    0x00, 0xf8, 0x6f, 0xff, 0xff, 0xf1, 0x00, 0x0f, 0x90, 0x00, 0x00, 0x0f, 0x90, 0x00, 0x00, 0x0f,
+    0x90, 0x00, 0x00, 0x0f, 0x90, 0x00, 0x00, 0x0f, 0x90, 0x00, 0x00, 0x0f, 0x90, 0x00, 0x00, 0x0f,
+    0x90, 0x00, 0x00, 0x0f, 0x90, 0x00, 0x00, 0x0f, 0x90, 0x00, 0x00, 0x0f, 0x90, 0x00, 0x6f, 0xff,
+    0xff, 0xf1, 0x00, 0x1f, 0xff, 0xf7, 0x00, 0x00, 0x02, 0xf7, 0x00, 0x00, 0x02, 0xf7, 0x00, 0x00,
+    0x02, 0xf7, 0x00, 0x00, 0x02, 0xf7, 0x00, 0x00, 0x02, 0xf7, 0x00, 0x00, 0x02, 0xf7, 0x00, 0x00,
+    0x02, 0xf7, 0x00, 0x00, 0x02, 0xf6, 0x24, 0x00, 0x04, 0xf4, 0x2f, 0x61, 0x2c, 0xd0, 0x05, 0xbe,
+    0xeb, 0x30, 0xea, 0x00, 0x01, 0xcd, 0x20, 0xea, 0x00, 0x1b, 0xe2, 0x00, 0xea, 0x00, 0xbe, 0x30,
+    0x00, 0xea, 0x0a, 0xe4, 0x00, 0x00, 0xea, 0x8f, 0x40, 0x00, 0x00, 0xee, 0xff, 0x40, 0x00, 0x00,
+    0xef, 0x6c, 0xd1, 0x00, 0x00, 0xea, 0x03, 0xf9, 0x00, 0x00, 0xea, 0x00, 0x8f, 0x40, 0x00, 0xea,
+    0x00, 0x1d, 0xd1, 0x00, 0xea, 0x00, 0x04, 0xf9, 0x00, 0xea, 0x00, 0x00, 0xaf, 0x40, 0x5f, 0x40,
+    0x00, 0x00, 0x5f, 0x40, 0x00, 0x00, 0x5f, 0x40, 0x00, 0x00, 0x5f, 0x40, 0x00, 0x00, 0x5f, 0x40,
+    0x00, 0x00, 0x5f, 0x40, 0x00, 0x00, 0x5f, 0x40, 0x00, 0x00, 0x5f, 0x40, 0x00, 0x00, 0x5f, 0x40,
+    0x00, 0x00, 0x5f, 0x40, 0x00, 0x00, 0x5f, 0x40, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xfe, 0x5f, 0xe0,
+    0x00, 0x5f, 0xe0, 0x5f, 0xe4, 0x00, 0xae, 0xe0, 0x5f, 0xa9, 0x00, 0xea, 0xe0, 0x5f, 0x5d, 0x04,
+    0xd8, 0xe0, 0x5f, 0x2d, 0x39, 0x88, 0xe0, 0x5f, 0x29, 0x8e, 0x38, 0xe0, 0x5f, 0x24, 0xfd, 0x08,
+    0xe0, 0x5f, 0x20, 0xe8, 0x08, 0xe0, 0x5f, 0x20, 0x00, 0x08, 0xe0, 0x5f, 0x20, 0x00, 0x08, 0xe0,
+    0x5f, 0x20, 0x00, 0x08, 0xe0, 0x5f, 0x20, 0x00, 0x08, 0xe0, 0xef, 0x40, 0x00, 0xf8, 0xef, 0xa0,
+    0x00, 0xf8, 0xed, 0xf2, 0x00, 0xf8, 0xe9, 0xd7, 0x00, 0xf8, 0xe9, 0x7d, 0x00, 0xf8, 0xe9, 0x1f,
+    0x40, 0xf8, 0xe9, 0x0a, 0xa0, 0xf8, 0xe9, 0x04, 0xf1, 0xf8, 0xe9, 0x00, 0xd7, 0xf8, 0xe9, 0x00,
+    0x7d, 0xf8, 0xe9, 0x00, 0x1f, 0xf8, 0xe9, 0x00, 0x0a, 0xf8, 0x00, 0x3c, 0xee, 0x91, 0x00, 0x02,
+    0xe9, 0x12, 0xdb, 0x00, 0x09, 0xe0, 0x00, 0x5f, 0x30, 0x0d, 0xb0, 0x00, 0x1f, 0x70, 0x0f, 0x90,
+    0x00, 0x0f, 0xa0, 0x1f, 0x90, 0x00, 0x0e, 0xa0, 0x1f, 0x90, 0x00, 0x0e, 0xa0, 0x0f, 0x90, 0x00,
+    0x0f, 0xa0, 0x0d, 0xb0, 0x00, 0x1f, 0x70, 0x09, 0xe0, 0x00, 0x5f, 0x30, 0x02, 0xe9, 0x12, 0xdb,
+    0x00, 0x00, 0x3c, 0xfe, 0x91, 0x00, 0x7f, 0xff, 0xec, 0x50, 0x7f, 0x20, 0x19, 0xf6, 0x7f, 0x20,
+    0x00, 0xec, 0x7f, 0x20, 0x00, 0xcd, 0x7f, 0x20, 0x00, 0xeb, 0x7f, 0x20, 0x19, 0xf5, 0x7f, 0xff,
+    0xec, 0x50, 0x7f, 0x20, 0x00, 0x00, 0x7f, 0x20, 0x00, 0x00, 0x7f, 0x20, 0x00, 0x00, 0x7f, 0x20,
+    0x00, 0x00, 0x7f, 0x20, 0x00, 0x00, 0x00, 0x3c, 0xee, 0x91, 0x00, 0x02, 0xe9, 0x12, 0xdb, 0x00,
+    0x09, 0xe0, 0x00, 0x5f, 0x30, 0x0d, 0xb0, 0x00, 0x1f, 0x70, 0x0f, 0x90, 0x00, 0x0f, 0x90, 0x1f,
+    0x90, 0x00, 0x0e, 0xa0, 0x1f, 0x90, 0x00, 0x0e, 0xa0, 0x0f, 0x90, 0x00, 0x0f, 0x90, 0x0d, 0xb0,
+    0x00, 0x1f, 0x70, 0x09, 0xe0, 0x00, 0x5f, 0x40, 0x02, 0xe9, 0x12, 0xdb, 0x00, 0x00, 0x3c, 0xff,
+    0xd1, 0x00, 0x00, 0x00, 0x06, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x89, 0x00, 0xdf, 0xff, 0xd8, 0x10,
+    0x00, 0xdb, 0x00, 0x4e, 0xb0, 0x00, 0xdb, 0x00, 0x08, 0xf3, 0x00, 0xdb, 0x00, 0x05, 0xf5, 0x00,
+    0xdb, 0x00, 0x07, 0xf3, 0x00, 0xdb, 0x00, 0x4e, 0xa0, 0x00, 0xdf, 0xff, 0xf8, 0x00, 0x00, 0xdb,
+    0x01, 0x7f, 0x40, 0x00, 0xdb, 0x00, 0x0b, 0xd0, 0x00, 0xdb, 0x00, 0x03, 0xf6, 0x00, 0xdb, 0x00,
+    0x00, 0xbd, 0x00, 0xdb, 0x00, 0x00, 0x4f, 0x60, 0x04, 0xbe, 0xea, 0x30, 0x5f, 0x71, 0x19, 0xe0,
+    0xcb, 0x00, 0x00, 0x60, 0xda, 0x00, 0x00, 0x00, 0xae, 0x30, 0x00, 0x00, 0x2c, 0xfc, 0x83, 0x00,
+    0x00, 0x48, 0xcf, 0xa0, 0x00, 0x00, 0x06, 0xf5, 0x00, 0x00, 0x00, 0xf8, 0x70, 0x00, 0x01, 0xf7,
+    0xcc, 0x40, 0x2b, 0xe2, 0x29, 0xdf, 0xda, 0x30, 0x9f, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0xf9,
+    0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00,
+    0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00,
+    0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00,
+    0x00, 0xf9, 0x00, 0x00, 0xdb, 0x00, 0x01, 0xf7, 0xdb, 0x00, 0x01, 0xf7, 0xdb, 0x00, 0x01, 0xf7,
+    0xdb, 0x00, 0x01, 0xf7, 0xdb, 0x00, 0x01, 0xf7, 0xdb, 0x00, 0x01, 0xf7, 0xdb, 0x00, 0x01, 0xf7,
+    0xdb, 0x00, 0x01, 0xf7, 0xcb, 0x00, 0x01, 0xf7, 0xac, 0x00, 0x03, 0xf5, 0x5f, 0x71, 0x2b, 0xe1,
+    0x05, 0xce, 0xea, 0x20, 0x6f, 0x30, 0x00, 0x09, 0xf1, 0x2f, 0x70, 0x00, 0x0c, 0xb0, 0x0d, 0xb0,
+    0x00, 0x1f, 0x70, 0x08, 0xe0, 0x00, 0x5f, 0x30, 0x04, 0xf3, 0x00, 0x9e, 0x00, 0x00, 0xe7, 0x00,
+    0xd9, 0x00, 0x00, 0xbb, 0x02, 0xf5, 0x00, 0x00, 0x6f, 0x06, 0xf1, 0x00, 0x00, 0x2f, 0x4a, 0xc0,
+    0x00, 0x00, 0x0d, 0x8d, 0x70, 0x00, 0x00, 0x09, 0xdf, 0x30, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x00,
+    0xe9, 0x00, 0x00, 0x00, 0xe8, 0xcb, 0x00, 0x00, 0x01, 0xf6, 0xad, 0x00, 0x00, 0x03, 0xf4, 0x7e,
+    0x02, 0xfb, 0x05, 0xf2, 0x5f, 0x15, 0xfe, 0x06, 0xf0, 0x3f, 0x38, 0xaf, 0x28, 0xd0, 0x1f, 0x4b,
+    0x6c, 0x5a, 0xa0, 0x0e, 0x6e, 0x39, 0x8c, 0x80, 0x0b, 0x9e, 0x05, 0xbd, 0x60, 0x09, 0xec, 0x02,
+    0xef, 0x40, 0x07, 0xf8, 0x00, 0xef, 0x20, 0x05, 0xf5, 0x00, 0xbe, 0x00, 0x1e, 0xa0, 0x00, 0x0b,
+    0xd1, 0x06, 0xf3, 0x00, 0x5f, 0x50, 0x00, 0xcc, 0x00, 0xda, 0x00, 0x00, 0x4f, 0x57, 0xe2, 0x00,
+    0x00, 0x0a, 0xde, 0x70, 0x00, 0x00, 0x02, 0xfd, 0x00, 0x00, 0x00, 0x07, 0xff, 0x40, 0x00, 0x00,
+    0x2e, 0x8a, 0xc0, 0x00, 0x00, 0xbd, 0x12, 0xf6, 0x00, 0x05, 0xf5, 0x00, 0x9e, 0x10, 0x1d, 0xb0,
+    0x00, 0x1e, 0x90, 0x8f, 0x20, 0x00, 0x07, 0xf3, 0x6f, 0x40, 0x00, 0x09, 0xe2, 0x0d, 0xc0, 0x00,
+    0x2f, 0x70, 0x04, 0xf5, 0x00, 0xad, 0x10, 0x00, 0xbd, 0x03, 0xf5, 0x00, 0x00, 0x3f, 0x6b, 0xc0,
+    0x00, 0x00, 0x09, 0xef, 0x40, 0x00, 0x00, 0x01, 0xfb, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00,
+    0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00,
+    0x00, 0xf9, 0x00, 0x00, 0x9f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00,
+    0x0b, 0xf3, 0x00, 0x00, 0x00, 0x6f, 0x90, 0x00, 0x00, 0x01, 0xed, 0x10, 0x00, 0x00, 0x09, 0xf5,
+    0x00, 0x00, 0x00, 0x3f, 0xa0, 0x00, 0x00, 0x00, 0xce, 0x20, 0x00, 0x00, 0x06, 0xf7, 0x00, 0x00,
+    0x00, 0x1e, 0xc0, 0x00, 0x00, 0x00, 0x9f, 0x30, 0x00, 0x00, 0x00, 0xcf, 0xff, 0xff, 0xff, 0x20,
+    0x6f, 0xfe, 0x6f, 0x10, 0x6f, 0x10, 0x6f, 0x10, 0x6f, 0x10, 0x6f, 0x10, 0x6f, 0x10, 0x6f, 0x10,
+    0x6f, 0x10, 0x6f, 0x10, 0x6f, 0x10, 0x6f, 0x10, 0x6f, 0x10, 0x6f, 0xfe, 0x1e, 0x80, 0x00, 0x00,
+    0x00, 0x07, 0xe1, 0x00, 0x00, 0x00, 0x01, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x10, 0x00, 0x00,
+    0x00, 0x2f, 0x60, 0x00, 0x00, 0x00, 0x09, 0xd0, 0x00, 0x00, 0x00, 0x02, 0xf5, 0x00, 0x00, 0x00,
+    0x00, 0xad, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x50, 0x00, 0x00, 0x00, 0x0b, 0xc0, 0x00, 0x00, 0x00,
+    0x03, 0xf4, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x30, 0x4f, 0xff, 0x00,
+    0x00, 0x6f, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x6f, 0x00, 0x00,
+    0x6f, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x6f,
+    0x00, 0x00, 0x6f, 0x00, 0x4f, 0xff, 0x00, 0x00, 0x05, 0xfd, 0x10, 0x00, 0x00, 0x4f, 0x8c, 0xc1,
+    0x00, 0x03, 0xe7, 0x01, 0xcb, 0x00, 0x2d, 0x70, 0x00, 0x1c, 0x90, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x6e, 0x20, 0x08, 0xc0, 0x00, 0xa8, 0x06, 0xce, 0xea, 0x20, 0x49, 0x30, 0x2b, 0xd0, 0x00, 0x00,
+    0x03, 0xf3, 0x06, 0xce, 0xff, 0xf4, 0x7e, 0x51, 0x03, 0xf4, 0xd9, 0x00, 0x05, 0xf4, 0xd8, 0x00,
+    0x09, 0xf4, 0x9e, 0x31, 0x6e, 0xf4, 0x19, 0xee, 0xb5, 0xf4, 0x7e, 0x00, 0x00, 0x00, 0x7e, 0x00,
+    0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x7e, 0x5d, 0xfb, 0x30, 0x7f, 0xc2, 0x2b, 0xd0, 0x7f, 0x40,
+    0x02, 0xf6, 0x7f, 0x10, 0x00, 0xe9, 0x7f, 0x00, 0x00, 0xda, 0x7f, 0x10, 0x00, 0xe8, 0x7f, 0x40,
+    0x02, 0xf6, 0x7f, 0xc2, 0x2b, 0xd0, 0x7e, 0x6d, 0xfb, 0x30, 0x00, 0x6c, 0xfd, 0x80, 0x08, 0xe6,
+    0x12, 0x64, 0x2f, 0x70, 0x00, 0x00, 0x6f, 0x20, 0x00, 0x00, 0x7f, 0x10, 0x00, 0x00, 0x6f, 0x30,
+    0x00, 0x00, 0x2f, 0x70, 0x00, 0x00, 0x08, 0xe6, 0x12, 0x64, 0x00, 0x6c, 0xfd, 0x80, 0x00, 0x00,
+    0x00, 0x4f, 0x20, 0x00, 0x00, 0x00, 0x4f, 0x20, 0x00, 0x00, 0x00, 0x4f, 0x20, 0x00, 0x6d, 0xfc,
+    0x7f, 0x20, 0x04, 0xf7, 0x15, 0xef, 0x20, 0x0b, 0xc0, 0x00, 0x9f, 0x20, 0x0e, 0x90, 0x00, 0x6f,
+    0x20, 0x0f, 0x80, 0x00, 0x5f, 0x20, 0x0e, 0x90, 0x00, 0x6f, 0x20, 0x0b, 0xc0, 0x00, 0x9f, 0x20,
+    0x04, 0xf6, 0x15, 0xef, 0x20, 0x00, 0x6d, 0xfc, 0x7f, 0x20, 0x00, 0x2a, 0xee, 0xb2, 0x00, 0x02,
+    0xea, 0x21, 0xad, 0x00, 0x0a, 0xd0, 0x00, 0x1e, 0x60, 0x0e, 0x90, 0x00, 0x0c, 0x90, 0x0f, 0xff,
+    0xff, 0xff, 0xa0, 0x0e, 0x80, 0x00, 0x00, 0x00, 0x0a, 0xc0, 0x00, 0x00, 0x00, 0x02, 0xe9, 0x21,
+    0x39, 0x50, 0x00, 0x3a, 0xee, 0xc6, 0x00, 0x00, 0x05, 0xdf, 0xf5, 0x00, 0x0e, 0x80, 0x00, 0x00,
+    0x2f, 0x50, 0x00, 0x7f, 0xff, 0xff, 0xf5, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x2f, 0x40, 0x00, 0x00,
+    0x2f, 0x40, 0x00, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x2f, 0x40, 0x00, 0x00,
+    0x2f, 0x40, 0x00, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x5d, 0xfc, 0x7f, 0x20, 0x04, 0xf7, 0x15, 0xef,
+    0x20, 0x0b, 0xc0, 0x00, 0x9f, 0x20, 0x0e, 0x90, 0x00, 0x6f, 0x20, 0x0f, 0x80, 0x00, 0x5f, 0x20,
+    0x0e, 0x90, 0x00, 0x6f, 0x20, 0x0b, 0xc0, 0x00, 0x9f, 0x20, 0x04, 0xf7, 0x14, 0xef, 0x20, 0x00,
+    0x6d, 0xfc, 0x7f, 0x20, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x01, 0xa3, 0x13, 0xd9, 0x00, 0x00, 0x5c,
+    0xed, 0x81, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x7f,
+    0x4c, 0xfc, 0x30, 0x7f, 0xb2, 0x1c, 0xd0, 0x7f, 0x30, 0x05, 0xf2, 0x7f, 0x00, 0x04, 0xf3, 0x7f,
+    0x00, 0x04, 0xf3, 0x7f, 0x00, 0x04, 0xf3, 0x7f, 0x00, 0x04, 0xf3, 0x7f, 0x00, 0x04, 0xf3, 0x7f,
+    0x00, 0x04, 0xf3, 0x00, 0x0b, 0xa0, 0x00, 0x00, 0x0b, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+    0xff, 0xa0, 0x00, 0x00, 0x0b, 0xa0, 0x00, 0x00, 0x0b, 0xa0, 0x00, 0x00, 0x0b, 0xa0, 0x00, 0x00,
+    0x0b, 0xa0, 0x00, 0x00, 0x0b, 0xa0, 0x00, 0x00, 0x0b, 0xa0, 0x00, 0x00, 0x0b, 0xa0, 0x00, 0x9f,
+    0xff, 0xff, 0xf8, 0x00, 0x05, 0xf2, 0x00, 0x05, 0xf2, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xf2, 0x00,
+    0x05, 0xf2, 0x00, 0x05, 0xf2, 0x00, 0x05, 0xf2, 0x00, 0x05, 0xf2, 0x00, 0x05, 0xf2, 0x00, 0x05,
+    0xf2, 0x00, 0x05, 0xf2, 0x00, 0x05, 0xf2, 0x00, 0x06, 0xf1, 0x00, 0x1b, 0xc0, 0x8f, 0xfc, 0x30,
+    0x2f, 0x50, 0x00, 0x00, 0x00, 0x2f, 0x50, 0x00, 0x00, 0x00, 0x2f, 0x50, 0x00, 0x00, 0x00, 0x2f,
+    0x50, 0x06, 0xf5, 0x00, 0x2f, 0x50, 0x6f, 0x50, 0x00, 0x2f, 0x56, 0xf5, 0x00, 0x00, 0x2f, 0xbf,
+    0x90, 0x00, 0x00, 0x2f, 0xfa, 0xf3, 0x00, 0x00, 0x2f, 0x60, 0xcd, 0x10, 0x00, 0x2f, 0x50, 0x2e,
+    0x90, 0x00, 0x2f, 0x50, 0x06, 0xf5, 0x00, 0x2f, 0x50, 0x00, 0xbe, 0x20, 0xbf, 0xff, 0x00, 0x00,
+    0x00, 0x7f, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00,
+    0x00, 0x7f, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00,
+    0x00, 0x6f, 0x10, 0x00, 0x00, 0x2f, 0x70, 0x00, 0x00, 0x06, 0xdf, 0xf1, 0x2f, 0xae, 0xc6, 0xed,
+    0x30, 0x2f, 0x72, 0xfc, 0x1a, 0xa0, 0x2f, 0x30, 0xd8, 0x07, 0xc0, 0x2f, 0x20, 0xc8, 0x07, 0xd0,
+    0x2f, 0x20, 0xc8, 0x07, 0xd0, 0x2f, 0x20, 0xc8, 0x07, 0xd0, 0x2f, 0x20, 0xc8, 0x07, 0xd0, 0x2f,
+    0x20, 0xc8, 0x07, 0xd0, 0x2f, 0x20, 0xc8, 0x07, 0xd0, 0x7f, 0x4c, 0xfc, 0x30, 0x7f, 0xb2, 0x1c,
+    0xd0, 0x7f, 0x30, 0x05, 0xf2, 0x7f, 0x00, 0x04, 0xf3, 0x7f, 0x00, 0x04, 0xf3, 0x7f, 0x00, 0x04,
+    0xf3, 0x7f, 0x00, 0x04, 0xf3, 0x7f, 0x00, 0x04, 0xf3, 0x7f, 0x00, 0x04, 0xf3, 0x04, 0xcf, 0xea,
+    0x10, 0x3f, 0x91, 0x3d, 0xc0, 0xae, 0x00, 0x04, 0xf4, 0xda, 0x00, 0x01, 0xf7, 0xe9, 0x00, 0x00,
+    0xf8, 0xda, 0x00, 0x01, 0xf7, 0xae, 0x00, 0x04, 0xf4, 0x3f, 0x91, 0x3d, 0xc0, 0x04, 0xcf, 0xea,
+    0x10, 0x8e, 0x6d, 0xfb, 0x20, 0x8f, 0xc2, 0x2b, 0xd0, 0x8f, 0x40, 0x02, 0xf5, 0x8f, 0x00, 0x00,
+    0xe8, 0x8e, 0x00, 0x00, 0xd9, 0x8f, 0x00, 0x00, 0xe8, 0x8f, 0x40, 0x02, 0xf5, 0x8f, 0xc2, 0x2b,
+    0xd0, 0x8e, 0x7d, 0xfb, 0x20, 0x8e, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00,
+    0x00, 0x05, 0xdf, 0xc7, 0xf4, 0x2f, 0x81, 0x4e, 0xf4, 0x9d, 0x00, 0x08, 0xf4, 0xca, 0x00, 0x04,
+    0xf4, 0xd9, 0x00, 0x03, 0xf4, 0xca, 0x00, 0x04, 0xf4, 0x9d, 0x00, 0x08, 0xf4, 0x3f, 0x81, 0x4e,
+    0xf4, 0x05, 0xdf, 0xc7, 0xf4, 0x00, 0x00, 0x03, 0xf4, 0x00, 0x00, 0x03, 0xf4, 0x00, 0x00, 0x03,
+    0xf4, 0x3f, 0x48, 0xee, 0x70, 0x3f, 0xc8, 0x22, 0x80, 0x3f, 0xb0, 0x00, 0x00, 0x3f, 0x60, 0x00,
+    0x00, 0x3f, 0x50, 0x00, 0x00, 0x3f, 0x40, 0x00, 0x00, 0x3f, 0x40, 0x00, 0x00, 0x3f, 0x40, 0x00,
+    0x00, 0x3f, 0x40, 0x00, 0x00, 0x03, 0xbe, 0xe9, 0x20, 0x1e, 0x91, 0x15, 0x70, 0x4f, 0x30, 0x00,
+    0x00, 0x2f, 0xb4, 0x10, 0x00, 0x04, 0xcf, 0xfc, 0x30, 0x00, 0x01, 0x5d, 0xd0, 0x00, 0x00, 0x07,
+    0xf0, 0x59, 0x31, 0x2c, 0xb0, 0x06, 0xce, 0xd9, 0x10, 0x00, 0xac, 0x00, 0x00, 0x00, 0xac, 0x00,
+    0x00, 0xff, 0xff, 0xff, 0xf1, 0x00, 0xac, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0xac, 0x00,
+    0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x6f, 0x40,
+    0x00, 0x00, 0x09, 0xef, 0xf1, 0x7f, 0x00, 0x04, 0xf3, 0x7f, 0x00, 0x04, 0xf3, 0x7f, 0x00, 0x04,
+    0xf3, 0x7f, 0x00, 0x04, 0xf3, 0x7f, 0x00, 0x04, 0xf3, 0x7f, 0x00, 0x04, 0xf3, 0x6f, 0x10, 0x07,
+    0xf3, 0x2f, 0x81, 0x3d, 0xf3, 0x06, 0xdf, 0xb6, 0xf3, 0x1f, 0x70, 0x00, 0x0c, 0xa0, 0x0b, 0xc0,
+    0x00, 0x2f, 0x50, 0x05, 0xf2, 0x00, 0x7e, 0x10, 0x01, 0xe7, 0x00, 0xca, 0x00, 0x00, 0xac, 0x02,
+    0xf5, 0x00, 0x00, 0x5f, 0x27, 0xe0, 0x00, 0x00, 0x0e, 0x7d, 0x90, 0x00, 0x00, 0x09, 0xef, 0x40,
+    0x00, 0x00, 0x04, 0xfe, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0xd8, 0xab, 0x00, 0x00, 0x01, 0xf4,
+    0x7e, 0x00, 0x00, 0x05, 0xf1, 0x3f, 0x20, 0xe8, 0x08, 0xd0, 0x0e, 0x53, 0xdd, 0x0b, 0x90, 0x0b,
+    0x88, 0x7d, 0x2e, 0x60, 0x08, 0xcc, 0x38, 0x9f, 0x20, 0x04, 0xfd, 0x04, 0xfe, 0x00, 0x01, 0xf9,
+    0x00, 0xeb, 0x00, 0x0b, 0xc0, 0x00, 0x4f, 0x60, 0x01, 0xe9, 0x01, 0xda, 0x00, 0x00, 0x4f, 0x4a,
+    0xd1, 0x00, 0x00, 0x08, 0xef, 0x30, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x0c, 0xce, 0x70,
+    0x00, 0x00, 0x9e, 0x26, 0xf3, 0x00, 0x05, 0xf5, 0x00, 0xad, 0x10, 0x2e, 0x90, 0x00, 0x1e, 0xa0,
+    0x1e, 0x80, 0x00, 0x0b, 0xc0, 0x09, 0xd0, 0x00, 0x1f, 0x70, 0x03, 0xf4, 0x00, 0x6f, 0x10, 0x00,
+    0xc9, 0x00, 0xca, 0x00, 0x00, 0x7e, 0x12, 0xf4, 0x00, 0x00, 0x1f, 0x68, 0xd0, 0x00, 0x00, 0x0a,
+    0xbd, 0x80, 0x00, 0x00, 0x04, 0xff, 0x20, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x02, 0xf5,
+    0x00, 0x00, 0x00, 0x1a, 0xd0, 0x00, 0x00, 0x08, 0xfc, 0x30, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xf2,
+    0x00, 0x00, 0x0b, 0xe1, 0x00, 0x00, 0x8f, 0x40, 0x00, 0x04, 0xf8, 0x00, 0x00, 0x2e, 0xb0, 0x00,
+    0x00, 0xce, 0x10, 0x00, 0x09, 0xf4, 0x00, 0x00, 0x4f, 0x70, 0x00, 0x00, 0x6f, 0xff, 0xff, 0xf2,
+    0x00, 0x03, 0xbe, 0xe0, 0x00, 0x0a, 0xd2, 0x00, 0x00, 0x0d, 0xa0, 0x00, 0x00, 0x0d, 0x90, 0x00,
+    0x00, 0x0d, 0x90, 0x00, 0x00, 0x0e, 0x80, 0x00, 0x01, 0x6f, 0x50, 0x00, 0x4f, 0xf9, 0x00, 0x00,
+    0x01, 0x6f, 0x50, 0x00, 0x00, 0x0e, 0x80, 0x00, 0x00, 0x0d, 0x90, 0x00, 0x00, 0x0d, 0x90, 0x00,
+    0x00, 0x0d, 0xa0, 0x00, 0x00, 0x0a, 0xd2, 0x00, 0x00, 0x03, 0xbe, 0xe0, 0xd7, 0xd7, 0xd7, 0xd7,
+    0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0x4f, 0xe9, 0x00, 0x00,
+    0x00, 0x5f, 0x40, 0x00, 0x00, 0x0f, 0x70, 0x00, 0x00, 0x0f, 0x70, 0x00, 0x00, 0x0f, 0x70, 0x00,
+    0x00, 0x0e, 0x80, 0x00, 0x00, 0x0a, 0xd3, 0x00, 0x00, 0x02, 0xdf, 0xe0, 0x00, 0x0a, 0xd2, 0x00,
+    0x00, 0x0e, 0x80, 0x00, 0x00, 0x0f, 0x70, 0x00, 0x00, 0x0f, 0x70, 0x00, 0x00, 0x0f, 0x70, 0x00,
+    0x00, 0x5f, 0x40, 0x00, 0x4f, 0xe9, 0x00, 0x00, 0x19, 0xde, 0xa5, 0x13, 0xa0, 0x47, 0x21, 0x6b,
+    0xec, 0x50,
+};
+
+static const display_glyph_t glyphs[95] = {
+    {    0,  0,  0,   0,   0, 10},  // space
+    {    0,  2, 12,   4,   3, 10},  // !
+    {   12,  5,  4,   2,   3, 10},  // "
+    {   24, 10, 11,   0,   4, 10},  // #
+    {   79,  8, 14,   1,   3, 10},  // $
+    {  135, 10, 12,   0,   3, 10},  // %
+    {  195, 10, 12,   0,   3, 10},  // &
+    {  255,  2,  4,   4,   3, 10},  // '
+    {  259,  4, 14,   3,   3, 10},  // (
+    {  287,  5, 14,   2,   3, 10},  // )
+    {  329,  8,  8,   1,   3, 10},  // *
+    {  361,  9,  7,   0,   7, 10},  // +
+    {  396,  3,  5,   3,  13, 10},  // ,
+    {  406,  5,  1,   2,  10, 10},  // -
+    {  409,  3,  2,   3,  13, 10},  // .
+    {  413,  9, 13,   0,   3, 10},  // /
+    {  478,  8, 12,   1,   3, 10},  // 0
+    {  526,  8, 12,   1,   3, 10},  // 1
+    {  574,  8, 12,   1,   3, 10},  // 2
+    {  622,  8, 12,   1,   3, 10},  // 3
+    {  670,  9, 12,   0,   3, 10},  // 4
+    {  730,  8, 12,   1,   3, 10},  // 5
+    {  778,  8, 12,   1,   3, 10},  // 6
+    {  826,  8, 12,   1,   3, 10},  // 7
+    {  874,  8, 12,   1,   3, 10},  // 8
+    {  922,  8, 12,   1,   3, 10},  // 9
+    {  970,  3,  8,   3,   7, 10},  // :
+    {  986,  3, 11,   3,   7, 10},  // ;
+    { 1008,  9,  8,   0,   6, 10},  // <
+    { 1048,  9,  4,   0,   8, 10},  // =
+    { 1068,  9,  8,   0,   6, 10},  // >
+    { 1108,  8, 12,   1,   3, 10},  // ?
+    { 1156, 10, 14,   0,   4, 10},  // @
+    { 1226, 10, 12,   0,   3, 10},  // A
+    { 1286,  8, 12,   1,   3, 10},  // B
+    { 1334,  8, 12,   1,   3, 10},  // C
+    { 1382,  8, 12,   1,   3, 10},  // D
+    { 1430,  8, 12,   1,   3, 10},  // E
+    { 1478,  8, 12,   1,   3, 10},  // F
+    { 1526,  9, 12,   0,   3, 10},  // G
+    { 1586,  8, 12,   1,   3, 10},  // H
+    { 1634,  8, 12,   1,   3, 10},  // I
+    { 1682,  8, 12,   0,   3, 10},  // J
+    { 1730,  9, 12,   1,   3, 10},  // K
+    { 1790,  8, 12,   1,   3, 10},  // L
+    { 1838,  9, 12,   0,   3, 10},  // M
+    { 1898,  8, 12,   1,   3, 10},  // N
+    { 1946,  9, 12,   0,   3, 10},  // O
+    { 2006,  8, 12,   1,   3, 10},  // P
+    { 2054,  9, 14,   0,   3, 10},  // Q
+    { 2124,  9, 12,   1,   3, 10},  // R
+    { 2184,  8, 12,   1,   3, 10},  // S
+    { 2232, 10, 12,   0,   3, 10},  // T
+    { 2292,  8, 12,   1,   3, 10},  // U
+    { 2340, 10, 12,   0,   3, 10},  // V
+    { 2400, 10, 12,   0,   3, 10},  // W
+    { 2460, 10, 12,   0,   3, 10},  // X
+    { 2520, 10, 12,   0,   3, 10},  // Y
+    { 2580,  9, 12,   1,   3, 10},  // Z
+    { 2640,  4, 14,   3,   3, 10},  // [
+    { 2668,  9, 13,   0,   3, 10},  // backslash
+    { 2733,  5, 14,   2,   3, 10},  // ]
+    { 2775,  9,  4,   0,   3, 10},  // ^
+    { 2795, 10,  1,   0,  18, 10},  // _
+    { 2800,  4,  3,   2,   2, 10},  // `
+    { 2806,  8,  9,   1,   6, 10},  // a
+    { 2842,  8, 12,   1,   3, 10},  // b
+    { 2890,  8,  9,   1,   6, 10},  // c
+    { 2926,  9, 12,   0,   3, 10},  // d
+    { 2986,  9,  9,   0,   6, 10},  // e
+    { 3031,  8, 12,   1,   3, 10},  // f
+    { 3079,  9, 12,   0,   6, 10},  // g
+    { 3139,  8, 12,   1,   3, 10},  // h
+    { 3187,  8, 12,   1,   3, 10},  // i
+    { 3235,  6, 15,   1,   3, 10},  // j
+    { 3280,  9, 12,   1,   3, 10},  // k
+    { 3340,  8, 12,   1,   3, 10},  // l
+    { 3388,  9,  9,   0,   6, 10},  // m
+    { 3433,  8,  9,   1,   6, 10},  // n
+    { 3469,  8,  9,   1,   6, 10},  // o
+    { 3505,  8, 12,   1,   6, 10},  // p
+    { 3553,  8, 12,   1,   6, 10},  // q
+    { 3601,  8,  9,   2,   6, 10},  // r
+    { 3637,  8,  9,   1,   6, 10},  // s
+    { 3673,  8, 11,   1,   4, 10},  // t
+    { 3717,  8,  9,   1,   6, 10},  // u
+    { 3753,  9,  9,   0,   6, 10},  // v
+    { 3798, 10,  9,   0,   6, 10},  // w
+    { 3843,  9,  9,   0,   6, 10},  // x
+    { 3888,  9, 12,   0,   6, 10},  // y
+    { 3948,  8,  9,   1,   6, 10},  // z
+    { 3984,  7, 15,   1,   3, 10},  // {
+    { 4044,  2, 16,   4,   3, 10},  // |
+    { 4060,  7, 15,   1,   3, 10},  // }
+    { 4120,  9,  2,   0,   9, 10},  // ~
+};
+
+const display_font_t display_font_dejavu_mono_16 = {
+    .bitmap = bitmap,
+    .glyphs = glyphs,
+    .first = 0x20,
+    .count = 95,
+    .line_height = 19,
+    .baseline = 15,
+};
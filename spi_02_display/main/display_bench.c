@@ -0,0 +1,277 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "display/display.h"
+#include "display/display_bus.h"
+#include "display/display_priv.h"
+#include "display/display_blend.h"
+#include "display/display_band.h"
+#include "display/display_shape.h"
+#include "display_bench.h"
+
+#define BENCH_BAND_ROWS 40
+#define BENCH_CHART_POINTS 31
+#define BENCH_CIRCLE_R 40
+
+static uint16_t *band;      // DMA-capable screen-wide BENCH_BAND_ROWS test pattern
+static int band_w;
+
+// Blend cases: band is the source, blend_dst the destination
+static uint16_t *blend_dst;
+static uint8_t *mask_a8;
+static uint8_t *mask_a4;
+
+// Shape cases: a zigzag chart across the screen
+static display_point_t chart[BENCH_CHART_POINTS];
+static display_shape_t chart_shape;
+static display_prim_t chart_prim;
+static display_list_t chart_list;
+
+void display_bench_op(const char *op, int iters, display_bench_fn_t fn) {
+    display_stats_t st;
+
+    display_wait_done();
+    display_stats_reset();
+    int64_t t0 = esp_timer_get_time();
+    for (int i = 0; i < iters; i++) {
+        fn(i);
+    }
+    display_wait_done();
+    int64_t us = esp_timer_get_time() - t0;
+    display_stats_get(&st);
+
+    if (us <= 0) us = 1;
+    double wire_us = (double)st.bytes * 8e6 / display_get_config()->clock_speed_hz;
+    printf("BENCH op=%s iters=%d us=%lld bytes=%llu trans=%lu blocked_us=%lld "
+           "wire_us=%.0f mbps=%.3f fps=%.2f bus_util=%.3f\n",
+           op, iters, (long long)us, (unsigned long long)st.bytes,
+           (unsigned long)st.transactions, (long long)st.blocked_us,
+           wire_us, (double)st.bytes / us, iters * 1e6 / us, wire_us / us);
+}
+
+void display_bench_cpu(const char *op, int iters, int pixels, display_bench_fn_t fn) {
+    int64_t t0 = esp_timer_get_time();
+    for (int i = 0; i < iters; i++) {
+        fn(i);
+    }
+    int64_t us = esp_timer_get_time() - t0;
+
+    if (us <= 0) us = 1;
+    printf("BENCH op=%s iters=%d us=%lld mpix_s=%.3f\n",
+           op, iters, (long long)us, (double)pixels * iters / us);
+}
+
+static void bench_init(int i) {
+    ili9341_init();
+}
+
+static void bench_clear_screen(int i) {
+    clear_screen((i & 1) ? 0xFFFF : 0x0000);
+}
+
+static void bench_clear_region_small(int i) {
+    clear_region(104, 144, 135, 175, (i & 1) ? 0xF800 : 0x001F);
+}
+
+static void bench_clear_region_half(int i) {
+    clear_region(0, 0, 239, 159, (i & 1) ? 0x07E0 : 0x0000);
+}
+
+static void bench_draw_image_full(int i) {
+    for (int y = 0; y < display_height(); y += BENCH_BAND_ROWS) {
+        draw_image(0, y, display_width(), BENCH_BAND_ROWS, band);
+    }
+}
+
+static void bench_draw_image_async_full(int i) {
+    for (int y = 0; y < display_height(); y += BENCH_BAND_ROWS) {
+        draw_image_async(0, y, display_width(), BENCH_BAND_ROWS, band, NULL, NULL);
+    }
+}
+
+static void bench_draw_image_small(int i) {
+    draw_image(104 + (i & 7), 144, 32, 32, band);
+}
+
+/* Reference for the blend kernels: each channel on its own, 8-bit alpha,
+ * exact division. */
+static uint16_t naive_blend_px(uint16_t dst, uint16_t src, int a) {
+    uint16_t b = DISPLAY_SWAP16(dst), f = DISPLAY_SWAP16(src);
+    int r = ((f >> 11) * a + (b >> 11) * (255 - a)) / 255;
+    int g = (((f >> 5) & 0x3F) * a + ((b >> 5) & 0x3F) * (255 - a)) / 255;
+    int bl = ((f & 0x1F) * a + (b & 0x1F) * (255 - a)) / 255;
+    return DISPLAY_SWAP16((uint16_t)((r << 11) | (g << 5) | bl));
+}
+
+static void bench_blend_uniform_naive(int i) {
+    for (int p = 0; p < band_w * BENCH_BAND_ROWS; p++) {
+        blend_dst[p] = naive_blend_px(blend_dst[p], band[p], 96);
+    }
+}
+
+static void bench_blend_uniform(int i) {
+    for (int y = 0; y < BENCH_BAND_ROWS; y++) {
+        display_blend_row(blend_dst + y * band_w, band + y * band_w, band_w, 96);
+    }
+}
+
+static void bench_blend_a8_naive(int i) {
+    for (int p = 0; p < band_w * BENCH_BAND_ROWS; p++) {
+        blend_dst[p] = naive_blend_px(blend_dst[p], band[p], mask_a8[p]);
+    }
+}
+
+static void bench_blend_a8(int i) {
+    for (int y = 0; y < BENCH_BAND_ROWS; y++) {
+        display_blend_row_a8(blend_dst + y * band_w, band + y * band_w, mask_a8 + y * band_w, band_w);
+    }
+}
+
+static void bench_blend_a4(int i) {
+    for (int y = 0; y < BENCH_BAND_ROWS; y++) {
+        display_blend_row_a4(blend_dst + y * band_w, band + y * band_w, mask_a4 + y * band_w / 2, 0, band_w);
+    }
+}
+
+/* Round icons on a 40 px grid: opaque cores, soft edges, clear corners. */
+static void bench_make_masks(void) {
+    for (int y = 0; y < BENCH_BAND_ROWS; y++) {
+        for (int x = 0; x < band_w; x++) {
+            int dx = x % 40 - 20, dy = y - 20;
+            int a = (18 * 18 - (dx * dx + dy * dy)) * 2;
+            a = a < 0 ? 0 : (a > 255 ? 255 : a);
+            mask_a8[y * band_w + x] = a;
+            uint8_t *m = &mask_a4[(y * band_w + x) / 2];
+            *m = (x & 1) ? ((*m & 0xF0) | (a >> 4)) : ((a >> 4) << 4);
+        }
+    }
+}
+
+static void bench_blend(int iters) {
+    int px = band_w * BENCH_BAND_ROWS;
+    blend_dst = malloc(px * 2);
+    mask_a8 = malloc(px);
+    mask_a4 = malloc(px / 2);
+    if (blend_dst && mask_a8 && mask_a4) {
+        bench_make_masks();
+        memset(blend_dst, 0x5A, px * 2);
+        display_bench_cpu("blend_uniform_naive", iters, px, bench_blend_uniform_naive);
+        display_bench_cpu("blend_uniform", iters, px, bench_blend_uniform);
+        display_bench_cpu("blend_a8_naive", iters, px, bench_blend_a8_naive);
+        display_bench_cpu("blend_a8", iters, px, bench_blend_a8);
+        display_bench_cpu("blend_a4", iters, px, bench_blend_a4);
+    } else {
+        printf("BENCH error=no_mem\n");
+    }
+    free(blend_dst);
+    free(mask_a8);
+    free(mask_a4);
+}
+
+/* The old way of drawing: a clear_region() window for every pixel. */
+static void plot_line_per_pixel(int x0, int y0, int x1, int y1, uint16_t color) {
+    int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy;
+    for (;;) {
+        clear_region(x0, y0, x0, y0, color);
+        if (x0 == x1 && y0 == y1) break;
+        int e2 = 2 * err;
+        if (e2 >= dy) {
+            err += dy;
+            x0 += sx;
+        }
+        if (e2 <= dx) {
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+static void bench_chart_per_pixel(int i) {
+    for (int k = 1; k < BENCH_CHART_POINTS; k++) {
+        plot_line_per_pixel(chart[k - 1].x, chart[k - 1].y, chart[k].x, chart[k].y, (i & 1) ? 0x07E0 : 0xFFE0);
+    }
+}
+
+static void bench_chart_spans(int i) {
+    draw_polyline(chart, BENCH_CHART_POINTS, (i & 1) ? 0x07E0 : 0xFFE0);
+}
+
+static void bench_chart_band(int i) {
+    int x0, y0, x1, y1;
+    chart_shape.color = (i & 1) ? 0x07E0 : 0xFFE0;
+    display_shape_bounds(&chart_shape, &x0, &y0, &x1, &y1);
+    display_list_render_region(&chart_list, x0, y0, x1, y1);
+}
+
+static void bench_circle_per_pixel(int i) {
+    int cx = display_width() / 2, cy = display_height() / 2, r = BENCH_CIRCLE_R;
+    for (int y = -r; y <= r; y++) {
+        for (int x = -r; x <= r; x++) {
+            if (x * x + y * y <= r * r + r) {
+                clear_region(cx + x, cy + y, cx + x, cy + y, (i & 1) ? 0xF800 : 0x001F);
+            }
+        }
+    }
+}
+
+static void bench_circle_spans(int i) {
+    fill_circle(display_width() / 2, display_height() / 2, BENCH_CIRCLE_R, (i & 1) ? 0xF800 : 0x001F);
+}
+
+static void bench_circle_outline(int i) {
+    draw_circle(display_width() / 2, display_height() / 2, BENCH_CIRCLE_R, (i & 1) ? 0xF800 : 0x001F);
+}
+
+static void bench_shapes(int iters) {
+    int w = display_width(), h = display_height();
+    for (int k = 0; k < BENCH_CHART_POINTS; k++) {
+        int phase = (k * 3) % 8;
+        chart[k].x = k * (w - 1) / (BENCH_CHART_POINTS - 1);
+        chart[k].y = h / 4 + (phase < 4 ? phase : 8 - phase) * h / 8;
+    }
+    chart_shape = display_shape_polyline(chart, BENCH_CHART_POINTS, false, 0x07E0);
+    display_list_init(&chart_list, &chart_prim, 1, 0x0000);
+    display_list_add_shape(&chart_list, &chart_shape);
+
+    display_bench_op("chart_per_pixel", iters, bench_chart_per_pixel);
+    display_bench_op("chart_spans", iters, bench_chart_spans);
+    display_bench_op("chart_band", iters, bench_chart_band);
+    display_bench_op("fill_circle_per_pixel", iters, bench_circle_per_pixel);
+    display_bench_op("fill_circle_spans", iters, bench_circle_spans);
+    display_bench_op("draw_circle_spans", iters, bench_circle_outline);
+}
+
+void display_bench_run(int iters) {
+    const display_config_t *cfg = display_get_config();
+
+    band_w = display_width();
+    int band_px = band_w * BENCH_BAND_ROWS;
+    band = heap_caps_malloc(band_px * 2, MALLOC_CAP_DMA);
+    if (!band) {
+        printf("BENCH error=no_mem\n");
+        return;
+    }
+    for (int i = 0; i < band_px; i++) {
+        band[i] = DISPLAY_SWAP16((uint16_t)(i * 0x0841));
+    }
+
+    printf("BENCH_BEGIN bus=%s clock_hz=%d max_transfer_sz=%d\n",
+           display_bus()->name, cfg->clock_speed_hz, cfg->max_transfer_sz);
+    display_bench_op("ili9341_init", 1, bench_init);
+    display_bench_op("clear_screen", iters, bench_clear_screen);
+    display_bench_op("clear_region_32x32", iters, bench_clear_region_small);
+    display_bench_op("clear_region_240x160", iters, bench_clear_region_half);
+    display_bench_op("draw_image_full", iters, bench_draw_image_full);
+    display_bench_op("draw_image_async_full", iters, bench_draw_image_async_full);
+    display_bench_op("draw_image_32x32", iters, bench_draw_image_small);
+    bench_shapes(iters);
+    bench_blend(iters);
+    printf("BENCH_END\n");
+
+    heap_caps_free(band);
+    band = NULL;
+}
@@ -0,0 +1,25 @@
+#ifndef DISPLAY_BENCH_H
+#define DISPLAY_BENCH_H
+
+// Display throughput benchmarks. Every case prints one line on the console:
+//
+//   BENCH op=<name> iters=<n> us=<total> bytes=<n> trans=<n> blocked_us=<n>
+//         wire_us=<n> mbps=<MB/s> fps=<iters/s> bus_util=<wire_us / us>
+//
+// (on one line). wire_us is the bytes sent at the configured SPI clock, so
+// the numbers compare between the SPI bus and the host emulator; there a
+// bus_util above 1 means the code outruns the wire.
+
+typedef void (*display_bench_fn_t)(int iter);
+
+// Time iters calls of fn, including the wait for the bus to drain.
+void display_bench_op(const char *op, int iters, display_bench_fn_t fn);
+
+// CPU-only cases producing pixels per call print
+//   BENCH op=<name> iters=<n> us=<total> mpix_s=<Mpixel/s>
+void display_bench_cpu(const char *op, int iters, int pixels, display_bench_fn_t fn);
+
+// Run the whole suite; the panel must be initialized.
+void display_bench_run(int iters);
+
+#endif
@@ -0,0 +1,115 @@
+#include "test_display.h"
+#include "display_priv.h"
+#include "display_blend.h"
+#include "unity.h"
+#include <string.h>
+
+// The packed kernels against a per-channel reference. Alpha is quantized
+// to 0..32 before blending, so the reference uses the same steps and the
+// kernels may round each channel off by up to two.
+
+static void check_pixel(uint16_t got, uint16_t bg, uint16_t fg, int a255) {
+    static const int shift[3] = {11, 5, 0};
+    static const int mask[3] = {31, 63, 31};
+    got = DISPLAY_SWAP16(got);
+    bg = DISPLAY_SWAP16(bg);
+    fg = DISPLAY_SWAP16(fg);
+
+    for (int c = 0; c < 3; c++) {
+        int b = (bg >> shift[c]) & mask[c];
+        int f = (fg >> shift[c]) & mask[c];
+        int g = (got >> shift[c]) & mask[c];
+        int want = b + ((f - b) * a255 + (f > b ? 127 : -127)) / 255;
+        TEST_ASSERT_INT_WITHIN(2, want, g);
+    }
+}
+
+static int quantized(int alpha) {
+    return ((alpha + 4) >> 3) * 255 / 32;
+}
+
+TEST_CASE("blend row kernels match the reference", "[blend]") {
+    static uint16_t src[64], dst[64], ref[64];
+    static uint8_t a8[64], a4[32];
+    uint32_t seed = 19;
+
+    for (int t = 0; t < 2000; t++) {
+        int n = test_rand(&seed) % 40 + 1;
+        int off = test_rand(&seed) % 3;     // odd offsets: 2-byte aligned only
+        int first = test_rand(&seed) % 5;
+        int alpha = test_rand(&seed) & 0xFF;
+        for (int i = 0; i < 64; i++) {
+            src[i] = test_rand(&seed);
+            ref[i] = test_rand(&seed);
+            // Plenty of fully transparent and opaque runs for the fast paths
+            int r = test_rand(&seed) % 3;
+            a8[i] = r == 0 ? 0 : r == 1 ? 255 : test_rand(&seed);
+        }
+        for (int i = 0; i < 32; i++) a4[i] = test_rand(&seed);
+
+        memcpy(dst, ref, sizeof(dst));
+        display_blend_row(dst + off, src + 3, n, alpha);
+        for (int i = 0; i < n; i++) {
+            check_pixel(dst[off + i], ref[off + i], src[3 + i], quantized(alpha));
+        }
+        for (int i = 0; i < off; i++) TEST_ASSERT_EQUAL_HEX16(ref[i], dst[i]);
+        TEST_ASSERT_EQUAL_HEX16_ARRAY(ref + off + n, dst + off + n, 64 - off - n);
+
+        memcpy(dst, ref, sizeof(dst));
+        display_blend_row_a8(dst + off, src + 1, a8, n);
+        for (int i = 0; i < n; i++) {
+            check_pixel(dst[off + i], ref[off + i], src[1 + i], quantized(a8[i]));
+        }
+        TEST_ASSERT_EQUAL_HEX16_ARRAY(ref + off + n, dst + off + n, 64 - off - n);
+
+        memcpy(dst, ref, sizeof(dst));
+        display_blend_row_a4(dst + off, src, a4, first, n);
+        for (int i = 0; i < n; i++) {
+            int p = first + i;
+            int nibble = (p & 1) ? a4[p / 2] & 0x0F : a4[p / 2] >> 4;
+            check_pixel(dst[off + i], ref[off + i], src[i], nibble * 17);
+        }
+        TEST_ASSERT_EQUAL_HEX16_ARRAY(ref + off + n, dst + off + n, 64 - off - n);
+    }
+}
+
+TEST_CASE("blend kernels keep opaque and transparent pixels exact", "[blend]") {
+    uint16_t src[8], dst[8];
+    uint8_t a8[8] = {0, 255, 0, 255, 255, 255, 0, 0};
+
+    for (int i = 0; i < 8; i++) {
+        src[i] = 0x1234 + i;
+        dst[i] = 0xABCD - i;
+    }
+    display_blend_row_a8(dst, src, a8, 8);
+    for (int i = 0; i < 8; i++) {
+        TEST_ASSERT_EQUAL_HEX16(a8[i] ? 0x1234 + i : 0xABCD - i, dst[i]);
+    }
+
+    display_blend_row(dst, src, 8, 255);
+    TEST_ASSERT_EQUAL_HEX16_ARRAY(src, dst, 8);
+}
+
+TEST_CASE("blended sprites are clipped to the buffer", "[blend]") {
+    static uint16_t buf[20 * 10];
+    static uint8_t mask[8 * 8];
+    const uint16_t red = DISPLAY_SWAP16(0xF800);
+
+    memset(mask, 0xFF, sizeof(mask));
+    const display_alpha_sprite_t s = {8, 8, NULL, 0xF800, mask, 8};
+
+    // 5 of the 8 columns and 5 of the 8 rows land inside
+    display_blend_sprite(&s, -3, 5, 255, buf, 0, 0, 20, 10);
+    int covered = 0;
+    for (int i = 0; i < 20 * 10; i++) {
+        if (buf[i] == red) covered++;
+        else TEST_ASSERT_EQUAL_HEX16(0, buf[i]);
+    }
+    TEST_ASSERT_EQUAL(25, covered);
+    TEST_ASSERT_EQUAL_HEX16(red, buf[5 * 20 + 4]);
+    TEST_ASSERT_EQUAL_HEX16(0, buf[5 * 20 + 5]);
+
+    // Half opacity over black halves the red channel
+    display_blend_sprite(&s, 10, 0, 128, buf, 0, 0, 20, 10);
+    TEST_ASSERT_INT_WITHIN(1, 16, DISPLAY_SWAP16(buf[10]) >> 11);
+}
@@ -0,0 +1,74 @@
+#include "test_display.h"
+#include "display.h"
+#include "display_priv.h"
+#include "display_host.h"
+#include "unity.h"
+#include <string.h>
+
+// Pixels the DMA can't read go out through the internal bounce buffers.
+// The emulator is told that this frame is such memory: anything sent from
+// it directly would arrive as 0xFF bytes.
+
+static uint16_t external[DISPLAY_PANEL_WIDTH * DISPLAY_PANEL_HEIGHT];
+static int done_count;
+
+static void count_done(void *arg) {
+    done_count++;
+}
+
+static uint16_t pattern(int i) {
+    return (uint16_t)(i * 2654435761u >> 9);
+}
+
+static void setup(int max_transfer_sz) {
+    display_config_t cfg = DISPLAY_CONFIG_DEFAULT();
+    cfg.bus = &display_bus_host;
+    cfg.max_transfer_sz = max_transfer_sz;
+    display_configure(&cfg);
+    test_display_setup();
+
+    for (int i = 0; i < DISPLAY_PANEL_WIDTH * DISPLAY_PANEL_HEIGHT; i++) {
+        external[i] = DISPLAY_SWAP16(pattern(i));
+    }
+    display_host_set_external(external, sizeof(external));
+    done_count = 0;
+}
+
+static void teardown(void) {
+    display_host_set_external(NULL, 0);
+    display_config_t cfg = DISPLAY_CONFIG_DEFAULT();
+    display_configure(&cfg);
+}
+
+TEST_CASE("images the DMA can't read are bounced", "[bounce]") {
+    // An odd buffer size splits pixels across bounce buffers
+    setup(1002);
+
+    draw_image_async(0, 0, DISPLAY_PANEL_WIDTH, DISPLAY_PANEL_HEIGHT, external, count_done, NULL);
+    // Bounced data is copied before the call returns
+    memset(external, 0, sizeof(external));
+    display_wait_done();
+    for (int i = 0; i < DISPLAY_PANEL_WIDTH * DISPLAY_PANEL_HEIGHT; i++) {
+        TEST_ASSERT_EQUAL_HEX16(pattern(i), display_host_pixel(i % DISPLAY_PANEL_WIDTH, i / DISPLAY_PANEL_WIDTH));
+    }
+    TEST_ASSERT_EQUAL(1, done_count);
+
+    teardown();
+}
+
+TEST_CASE("bounced images keep their window", "[bounce]") {
+    setup(4096);
+
+    clear_screen(0x0000);
+    draw_image(5, 7, 33, 21, external + 1001);
+    display_wait_done();
+    for (int y = 0; y < 21; y++) {
+        for (int x = 0; x < 33; x++) {
+            TEST_ASSERT_EQUAL_HEX16(pattern(1001 + y * 33 + x), display_host_pixel(5 + x, 7 + y));
+        }
+    }
+    TEST_ASSERT_EQUAL_HEX16(0, display_host_pixel(4, 7));
+    TEST_ASSERT_EQUAL_HEX16(0, display_host_pixel(38, 27));
+
+    teardown();
+}
@@ -0,0 +1,83 @@
+#include "test_display.h"
+#include "display.h"
+#include "display_host.h"
+#include "unity.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+void test_display_setup(void) {
+    display_select(NULL);
+    display_gpio_init();
+    TEST_ESP_OK(display_spi_init());
+    display_set_mirror(false, false);
+    display_set_rotation(DISPLAY_ROTATION_0);
+    ili9341_init();
+    display_scroll_reset();
+    display_wait_done();
+}
+
+static char *read_file(const char *path, size_t *len) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return NULL;
+
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char *buf = malloc(size > 0 ? size : 1);
+    if (buf && fread(buf, 1, size, f) != (size_t)size) {
+        free(buf);
+        buf = NULL;
+    }
+    fclose(f);
+    *len = size;
+    return buf;
+}
+
+void test_display_check(const char *name) {
+    char path[256];
+    char msg[320];
+    char *got;
+    size_t got_len;
+
+    display_wait_done();
+    FILE *f = open_memstream(&got, &got_len);
+    TEST_ASSERT_NOT_NULL(f);
+    TEST_ESP_OK(display_host_write_ppm(f));
+    fclose(f);
+
+    snprintf(path, sizeof(path), "%s/%s.ppm", TEST_GOLDEN_DIR, name);
+    if (getenv(TEST_GOLDEN_UPDATE_ENV)) {
+        TEST_ESP_OK(display_host_dump_ppm(path));
+        free(got);
+        return;
+    }
+
+    size_t want_len = 0;
+    char *want = read_file(path, &want_len);
+    if (!want) {
+        free(got);
+        snprintf(msg, sizeof(msg), "%s: no golden image", path);
+        TEST_FAIL_MESSAGE(msg);
+    }
+
+    size_t diff = 0;
+    while (diff < got_len && diff < want_len && got[diff] == want[diff]) diff++;
+    free(want);
+    free(got);
+    if (diff == got_len && got_len == want_len) return;
+
+    // The header is the same for every image; locate the first wrong pixel
+    int header = got_len - DISPLAY_HOST_WIDTH * DISPLAY_HOST_HEIGHT * 3;
+    int px = ((int)diff - header) / 3;
+    snprintf(path, sizeof(path), "%s.actual.ppm", name);
+    display_host_dump_ppm(path);
+    snprintf(msg, sizeof(msg), "%s differs from its golden image at (%d, %d), see %s",
+             name, px % DISPLAY_HOST_WIDTH, px / DISPLAY_HOST_WIDTH, path);
+    TEST_FAIL_MESSAGE(msg);
+}
+
+uint32_t test_rand(uint32_t *state) {
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
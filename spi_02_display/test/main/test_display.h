@@ -0,0 +1,21 @@
+#ifndef TEST_DISPLAY_H
+#define TEST_DISPLAY_H
+
+// Helpers shared by the display tests
+
+#include <stdint.h>
+
+#define TEST_GOLDEN_UPDATE_ENV "DISPLAY_UPDATE_GOLDEN"
+
+// Bring the default panel up afresh on the emulator: portrait, no scroll
+// area, all black.
+void test_display_setup(void);
+
+// Wait for the queued transfers and compare the panel with golden/<name>.ppm.
+// A mismatch leaves the picture in <name>.actual.ppm next to the binary.
+void test_display_check(const char *name);
+
+// Deterministic pseudo-random numbers, the same on every libc
+uint32_t test_rand(uint32_t *state);
+
+#endif
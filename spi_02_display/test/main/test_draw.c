@@ -0,0 +1,213 @@
+#include "test_display.h"
+#include "display.h"
+#include "display_priv.h"
+#include "display_host.h"
+#include "display_image.h"
+#include "display_sprite.h"
+#include "display_font.h"
+#include "display_blend.h"
+#include "display_shape.h"
+#include "display_band.h"
+#include "unity.h"
+#include <string.h>
+
+// Golden-image scenes: each one draws through the public API and compares
+// the whole panel with golden/<name>.ppm.
+
+static uint16_t rgb(int r, int g, int b) {
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+}
+
+TEST_CASE("fills, clipped and rotated", "[draw]") {
+    test_display_setup();
+
+    clear_screen(rgb(32, 32, 48));
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 6; j++) {
+            clear_region(8 + j * 38, 8 + i * 26, 8 + j * 38 + 29, 8 + i * 26 + 19,
+                         rgb(i * 32, j * 48, 255 - i * 32));
+        }
+    }
+    // Past the right and bottom edges
+    clear_region(220, 300, 400, 500, rgb(255, 255, 0));
+
+    // Landscape: the bar runs along the panel's rows
+    display_set_rotation(DISPLAY_ROTATION_90);
+    clear_region(0, 0, 319, 9, rgb(255, 0, 0));
+    clear_region(300, 200, 319, 239, rgb(0, 255, 0));
+    display_set_rotation(DISPLAY_ROTATION_0);
+
+    test_display_check("fill");
+}
+
+TEST_CASE("raw and RLE images", "[draw]") {
+    static uint16_t pixels[96 * 64];
+    static uint8_t blob[4 + 4 * (4 + 48 * 2 * 3)];
+    test_display_setup();
+
+    for (int y = 0; y < 64; y++) {
+        for (int x = 0; x < 96; x++) {
+            pixels[y * 96 + x] = DISPLAY_SWAP16(rgb(x * 8 / 3, y * 4, 255 - x * 2));
+        }
+    }
+    draw_image(10, 10, 96, 64, pixels);
+    draw_image_async(130, 10, 96, 64, pixels, NULL, NULL);
+    draw_image(144, 256, 96, 64, pixels);   // flush with the bottom-right corner
+
+    // 48x40 RLE in bands of 10 rows: per row a run of 16, then 32 literals
+    int n = 0;
+    blob[n++] = 10;
+    blob[n++] = 0;
+    blob[n++] = 0;
+    blob[n++] = 0;
+    for (int band = 0; band < 4; band++) {
+        int size_at = n;
+        n += 4;
+        for (int y = band * 10; y < band * 10 + 10; y++) {
+            uint16_t c = rgb(y * 6, 128, 64);
+            blob[n++] = 0x80 | 15;
+            blob[n++] = c >> 8;
+            blob[n++] = c & 0xFF;
+            blob[n++] = 31;
+            for (int x = 0; x < 32; x++) {
+                uint16_t p = rgb(x * 8, y * 6, x * 4);
+                blob[n++] = p >> 8;
+                blob[n++] = p & 0xFF;
+            }
+        }
+        uint32_t size = n - size_at - 4;
+        memcpy(&blob[size_at], &size, sizeof(size));
+    }
+    display_image_t img = {48, 40, DISPLAY_IMAGE_RLE, blob, n};
+    TEST_ESP_OK(draw_image_compressed(40, 120, &img));
+
+    display_image_t cached;
+    TEST_ESP_OK(display_image_cache(&img, &cached));
+    draw_image_asset(120, 120, &cached);
+    display_wait_done();
+    display_image_uncache(&cached);
+
+    test_display_check("image");
+}
+
+TEST_CASE("palette sprites at every depth", "[draw]") {
+    static const uint16_t pal1[2] = {0x0000, 0xFFE0};
+    static const uint16_t pal2[4] = {0x001F, 0x07E0, 0xF800, 0xFFFF};
+    static uint16_t pal4[16], pal8[256];
+    static uint8_t data1[9 * 2], data2[10 * 6], data4[16 * 16], data8[20 * 20];
+    test_display_setup();
+
+    clear_screen(rgb(40, 40, 40));
+    for (int i = 0; i < 16; i++) pal4[i] = rgb(i * 17, 255 - i * 17, 128);
+    for (int i = 0; i < 256; i++) pal8[i] = rgb(i, (i * 7) & 0xFF, 255 - i);
+
+    // 13x9 at 1 bpp: a diagonal checker; odd widths leave padding bits
+    for (int y = 0; y < 9; y++) {
+        for (int x = 0; x < 13; x++) {
+            if (((x + y) / 2) & 1) data1[y * 2 + x / 8] |= 0x80 >> (x % 8);
+        }
+    }
+    for (int y = 0; y < 10; y++) {
+        for (int x = 0; x < 22; x++) {
+            data2[y * 6 + x / 4] |= ((x / 3 + y) & 3) << (6 - 2 * (x % 4));
+        }
+    }
+    for (int y = 0; y < 16; y++) {
+        for (int x = 0; x < 31; x++) {
+            data4[y * 16 + x / 2] |= ((x + y) & 15) << ((x & 1) ? 0 : 4);
+        }
+    }
+    for (int i = 0; i < 20 * 20; i++) data8[i] = i * 13;
+
+    const display_sprite_t sprites[] = {
+        {13, 9, 1, data1, pal1},
+        {22, 10, 2, data2, pal2},
+        {31, 16, 4, data4, pal4},
+        {20, 20, 8, data8, pal8},
+    };
+    for (int i = 0; i < 4; i++) {
+        for (int k = 0; k < 3; k++) {
+            TEST_ESP_OK(draw_sprite(10 + k * 70 + i, 10 + i * 60 + k * 7, &sprites[i]));
+        }
+    }
+    TEST_ESP_OK(draw_sprite(225, 300, &sprites[3]));  // clipped at the corner
+
+    test_display_check("sprite");
+}
+
+TEST_CASE("anti-aliased text", "[draw]") {
+    const display_font_t *font = &display_font_dejavu_mono_16;
+    test_display_setup();
+
+    clear_screen(rgb(0, 0, 64));
+    TEST_ESP_OK(draw_text(4, 4, "The quick brown fox", font, 0xFFFF, rgb(0, 0, 64)));
+    TEST_ESP_OK(draw_text(4, 24, "jumps over 0123456789", font, rgb(255, 200, 0), rgb(0, 0, 64)));
+    TEST_ESP_OK(draw_text(4, 44, "{[(<@#$%&*>)]}", font, rgb(0, 255, 128), rgb(80, 0, 0)));
+    TEST_ESP_OK(draw_text(4, 64, "no glyph: \x01\x7f", font, 0x0000, 0xFFFF));
+    TEST_ESP_OK(draw_text(180, 84, "clipped at the edge", font, 0xFFFF, rgb(0, 96, 0)));
+    display_set_rotation(DISPLAY_ROTATION_90);
+    TEST_ESP_OK(draw_text(100, 200, "landscape", font, 0xFFFF, 0x0000));
+    display_set_rotation(DISPLAY_ROTATION_0);
+
+    test_display_check("text");
+}
+
+TEST_CASE("alpha blending in a band list", "[draw]") {
+    static uint8_t a8[48 * 48], a4[40 * 20];
+    static uint16_t px[32 * 32];
+    static display_prim_t storage[16];
+    display_list_t list;
+    test_display_setup();
+
+    // Radial falloff at 8 bits, horizontal ramp at 4
+    for (int y = 0; y < 48; y++) {
+        for (int x = 0; x < 48; x++) {
+            int d2 = (x - 24) * (x - 24) + (y - 24) * (y - 24);
+            a8[y * 48 + x] = d2 >= 576 ? 0 : 255 - d2 * 255 / 576;
+        }
+    }
+    for (int y = 0; y < 40; y++) {
+        for (int x = 0; x < 40; x++) {
+            a4[y * 20 + x / 2] |= (x * 16 / 40) << ((x & 1) ? 0 : 4);
+        }
+    }
+    for (int i = 0; i < 32 * 32; i++) px[i] = DISPLAY_SWAP16(rgb((i % 32) * 8, (i / 32) * 8, 200));
+
+    const display_alpha_sprite_t glow = {48, 48, NULL, rgb(255, 255, 0), a8, 8};
+    const display_alpha_sprite_t ramp = {40, 40, NULL, rgb(255, 0, 255), a4, 4};
+    const display_alpha_sprite_t tile = {32, 32, px, 0, NULL, 0};
+
+    display_list_init(&list, storage, 16, rgb(0, 32, 64));
+    for (int i = 0; i < 6; i++) {
+        display_list_add_fill(&list, 0, i * 50 + 10, 240, 25, rgb(i * 40, 80, 160 - i * 20));
+    }
+    display_list_add_alpha(&list, 20, 20, &glow, 255);
+    display_list_add_alpha(&list, 100, 40, &glow, 128);
+    display_list_add_alpha(&list, 215, 140, &glow, 255);    // clipped at the right edge
+    display_list_add_alpha(&list, 30, 150, &ramp, 255);
+    display_list_add_alpha(&list, 120, 200, &tile, 96);
+    display_list_add_text(&list, 20, 280, "blended text", &display_font_dejavu_mono_16, 0xFFFF);
+    TEST_ESP_OK(display_list_render(&list));
+
+    test_display_check("blend");
+}
+
+TEST_CASE("lines, circles and rounded boxes", "[draw]") {
+    static const display_point_t zigzag[] = {
+        {10, 300}, {40, 250}, {70, 290}, {100, 240}, {130, 310}, {160, 230}, {230, 270},
+    };
+    test_display_setup();
+
+    for (int i = 0; i < 12; i++) {
+        draw_line(120, 100, 120 + (i - 6) * 24, i & 1 ? -20 : 10, rgb(255, i * 20, 0));
+    }
+    draw_polyline(zigzag, sizeof(zigzag) / sizeof(zigzag[0]), rgb(0, 255, 255));
+    draw_circle(60, 160, 40, 0xFFFF);
+    fill_circle(60, 160, 25, rgb(255, 0, 128));
+    fill_circle(230, 20, 30, rgb(128, 255, 0));             // clipped
+    draw_round_rect(120, 130, 230, 210, 16, rgb(255, 255, 0));
+    fill_round_rect(135, 145, 215, 195, 8, rgb(0, 96, 255));
+    fill_round_rect(-20, 220, 30, 235, 6, rgb(255, 128, 0));
+
+    test_display_check("shape");
+}
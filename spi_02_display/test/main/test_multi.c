@@ -0,0 +1,137 @@
+#include "test_display.h"
+#include "display.h"
+#include "display_bus.h"
+#include "display_priv.h"
+#include "display_host.h"
+#include "display_font.h"
+#include "unity.h"
+
+// Two panels on one bus: each keeps its own memory, orientation, scroll
+// area and refresh rate, and long runs hold the bus in bounded quanta.
+
+// The host bus plus a lock that checks the core only takes it when idle
+static display_bus_t locking_bus;
+static bool held;
+static int acquires, in_flight, quantum, max_quantum;
+
+static void lock_queue(void *dev, display_xfer_t *x) {
+    in_flight++;
+    if (held) {
+        quantum += x->len;
+        if (quantum > max_quantum) max_quantum = quantum;
+    }
+    display_bus_host.queue(dev, x);
+}
+
+static void lock_reap(void *dev) {
+    in_flight--;
+    display_bus_host.reap(dev);
+}
+
+static esp_err_t lock_acquire(void *dev) {
+    TEST_ASSERT_FALSE(held);
+    TEST_ASSERT_EQUAL(0, in_flight);
+    held = true;
+    acquires++;
+    quantum = 0;
+    return ESP_OK;
+}
+
+static void lock_release(void *dev) {
+    TEST_ASSERT_TRUE(held);
+    TEST_ASSERT_EQUAL(0, in_flight);
+    held = false;
+}
+
+static display_t *second_panel(int burst_bytes) {
+    display_t *d;
+    display_config_t cfg = DISPLAY_CONFIG_DEFAULT();
+
+    locking_bus = display_bus_host;
+    locking_bus.queue = lock_queue;
+    locking_bus.reap = lock_reap;
+    locking_bus.acquire = lock_acquire;
+    locking_bus.release = lock_release;
+    acquires = max_quantum = 0;
+
+    cfg.bus = &locking_bus;
+    cfg.pin_cs = 17;
+    cfg.pin_dc = 16;
+    cfg.pin_rst = -1;
+    cfg.burst_bytes = burst_bytes;
+    TEST_ESP_OK(display_create(&cfg, &d));
+    display_select(d);
+    ili9341_init();
+    display_wait_done();
+    display_select(NULL);
+    return d;
+}
+
+TEST_CASE("panels keep their own memory and orientation", "[multi]") {
+    test_display_setup();
+    display_t *b = second_panel(0);
+
+    display_select(b);
+    display_set_rotation(DISPLAY_ROTATION_90);
+    TEST_ASSERT_EQUAL(320, display_width());
+    display_select(NULL);
+    TEST_ASSERT_EQUAL(240, display_width());
+
+    clear_screen(0xF800);
+    display_select(b);
+    clear_screen(0x001F);
+    clear_region(0, 0, 9, 9, 0x07E0);
+    TEST_ESP_OK(draw_text(0, 100, "b", &display_font_dejavu_mono_16, 0xFFFF, 0));
+    display_select(NULL);
+    TEST_ESP_OK(draw_text(0, 0, "a", &display_font_dejavu_mono_16, 0xFFFF, 0));
+    display_wait_done();
+    display_select(b);
+    display_wait_done();
+
+    TEST_ASSERT_EQUAL_HEX16(0x001F, display_host_pixel(100, 100));
+    TEST_ASSERT_EQUAL_HEX16(0x07E0, display_host_pixel(235, 5));   // landscape (0, 0) is top right
+    display_select(NULL);
+    TEST_ASSERT_EQUAL_HEX16(0xF800, display_host_pixel(100, 100));
+    TEST_ASSERT_EQUAL_HEX16(0xF800, display_host_pixel(235, 5));
+}
+
+TEST_CASE("long runs hold the shared bus in bounded quanta", "[multi]") {
+    test_display_setup();
+    display_t *b = second_panel(16384);
+
+    display_select(b);
+    clear_screen(0x001F);           // 150 KB: bursts
+    display_wait_done();
+    TEST_ASSERT_FALSE(held);
+    TEST_ASSERT_EQUAL(10, acquires);
+    // A quantum ends at the transfer that crosses burst_bytes
+    TEST_ASSERT_LESS_OR_EQUAL(16384 + display_get_config()->max_transfer_sz, max_quantum);
+
+    clear_region(0, 0, 9, 9, 0x07E0);   // short: no burst
+    display_wait_done();
+    TEST_ASSERT_EQUAL(10, acquires);
+    display_select(NULL);
+}
+
+TEST_CASE("scroll areas and refresh rates are per panel", "[multi]") {
+    test_display_setup();
+    display_t *b = second_panel(0);
+
+    display_select(b);
+    display_scroll_define(20, 20);
+    display_scroll_advance(10);
+    TEST_ASSERT_EQUAL(30, display_scroll_row(0));
+    int b_hz = display_set_frame_rate(30);
+    TEST_ASSERT_TRUE(b_hz != DISPLAY_REFRESH_HZ_DEFAULT);
+
+    display_select(NULL);
+    TEST_ASSERT_EQUAL(0, display_scroll_row(0));
+    TEST_ASSERT_EQUAL(319, display_scroll_row(319));
+    TEST_ASSERT_EQUAL(DISPLAY_REFRESH_HZ_DEFAULT, display_get_frame_rate());
+    display_scroll_advance(5);
+
+    display_select(b);
+    TEST_ASSERT_EQUAL(30, display_scroll_row(0));
+    TEST_ASSERT_EQUAL(b_hz, display_get_frame_rate());
+    display_select(NULL);
+}
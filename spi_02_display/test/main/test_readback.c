@@ -0,0 +1,127 @@
+#include "test_display.h"
+#include "display.h"
+#include "display_bus.h"
+#include "display_priv.h"
+#include "display_host.h"
+#include "display_readback.h"
+#include "display_blend.h"
+#include "display_shape.h"
+#include "unity.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Readback over the emulated MISO: what was drawn comes back in
+// draw_image() order in every rotation, screenshots match the panel, and
+// read-modify-write blending matches blending into a buffer.
+
+static uint16_t frame[DISPLAY_PANEL_WIDTH * DISPLAY_PANEL_HEIGHT];
+static uint16_t back[DISPLAY_PANEL_WIDTH * DISPLAY_PANEL_HEIGHT];
+
+TEST_CASE("read regions back in every rotation", "[readback]") {
+    display_config_t cfg = DISPLAY_CONFIG_DEFAULT();
+    cfg.bus = &display_bus_host;
+    cfg.max_transfer_sz = 1000;     // several RAMRDC pieces per read
+    display_configure(&cfg);
+    test_display_setup();
+
+    for (int rot = 0; rot < 4; rot++) {
+        display_set_rotation(rot);
+        int w = display_width(), h = display_height();
+        for (int i = 0; i < w * h; i++) frame[i] = DISPLAY_SWAP16((uint16_t)(i * 2654435761u >> 7));
+        draw_image(0, 0, w, h, frame);
+
+        TEST_ESP_OK(display_read_region(0, 0, w, h, back));
+        TEST_ASSERT_EQUAL_MEMORY(frame, back, w * h * 2);
+        TEST_ESP_OK(display_read_region(13, 17, 50, 31, back));
+        for (int y = 0; y < 31; y++) {
+            TEST_ASSERT_EQUAL_MEMORY(&frame[(17 + y) * w + 13], &back[y * 50], 50 * 2);
+        }
+        TEST_ESP_ERR(ESP_ERR_INVALID_ARG, display_read_region(w - 5, 0, 6, 1, back));
+    }
+
+    cfg = (display_config_t)DISPLAY_CONFIG_DEFAULT();
+    display_configure(&cfg);
+}
+
+TEST_CASE("screenshots and read-modify-write blending", "[readback]") {
+    static uint8_t alpha[20 * 20];
+    static uint16_t want[40 * 40], got[40 * 40];
+    char *shot, *panel;
+    size_t shot_len, panel_len;
+    test_display_setup();
+
+    clear_screen(0x1234);
+    fill_circle(100, 100, 30, 0xF81F);
+    FILE *f = open_memstream(&shot, &shot_len);
+    TEST_ESP_OK(display_screenshot_ppm(display_write_file, f));
+    fclose(f);
+    f = open_memstream(&panel, &panel_len);
+    TEST_ESP_OK(display_host_write_ppm(f));
+    fclose(f);
+    TEST_ASSERT_EQUAL(panel_len, shot_len);
+    TEST_ASSERT_EQUAL_MEMORY(panel, shot, panel_len);
+    free(shot);
+    free(panel);
+
+    // The sprite sits at (75, 87): partly left of the 40x40 box at (80, 80)
+    for (int i = 0; i < 20 * 20; i++) alpha[i] = i % 256;
+    const display_alpha_sprite_t s = {.width = 20, .height = 20, .color = 0x07E0, .alpha = alpha, .alpha_bits = 8};
+    TEST_ESP_OK(display_read_region(80, 80, 40, 40, want));
+    display_blend_sprite(&s, -5, 7, 200, want, 0, 0, 40, 40);
+    TEST_ESP_OK(display_blend_rmw(&s, 75, 87, 200));
+    TEST_ESP_OK(display_read_region(80, 80, 40, 40, got));
+    TEST_ASSERT_EQUAL_MEMORY(want, got, sizeof(want));
+
+    // Off the panel on either side: clipped, not an error
+    TEST_ESP_OK(display_blend_rmw(&s, -30, -30, 255));
+    TEST_ESP_OK(display_blend_rmw(&s, 230, 310, 255));
+}
+
+// The host bus with a clock switch that can be made to fail
+static display_bus_t flaky_bus;
+static int clocks[4], nclocks, fail_hz, reads;
+
+static esp_err_t flaky_set_clock(void *dev, int hz) {
+    if (nclocks < 4) clocks[nclocks] = hz;
+    nclocks++;
+    return hz == fail_hz ? ESP_FAIL : ESP_OK;
+}
+
+static esp_err_t counting_read(void *dev, uint8_t cmd, uint8_t *out, int len, int dummy_bits) {
+    reads++;
+    return display_bus_host.read(dev, cmd, out, len, dummy_bits);
+}
+
+TEST_CASE("a failed clock switch fails the read", "[readback]") {
+    display_t *p;
+    display_config_t cfg = DISPLAY_CONFIG_DEFAULT();
+    uint16_t px[4];
+
+    flaky_bus = display_bus_host;
+    flaky_bus.set_clock = flaky_set_clock;
+    flaky_bus.read = counting_read;
+    cfg.bus = &flaky_bus;
+    TEST_ESP_OK(display_create(&cfg, &p));
+    display_select(p);
+    reads = 0;
+
+    // No read at the write clock, and the write clock is put back
+    fail_hz = READ_CLOCK_HZ;
+    nclocks = 0;
+    TEST_ESP_ERR(ESP_FAIL, display_read_region(0, 0, 2, 2, px));
+    TEST_ASSERT_EQUAL(0, reads);
+    TEST_ASSERT_EQUAL(2, nclocks);
+    TEST_ASSERT_EQUAL(cfg.clock_speed_hz, clocks[1]);
+
+    // Read done, but stuck at the slow clock: still a failure
+    fail_hz = cfg.clock_speed_hz;
+    nclocks = 0;
+    TEST_ESP_ERR(ESP_FAIL, display_read_region(0, 0, 2, 2, px));
+    TEST_ASSERT_EQUAL(1, reads);
+    TEST_ASSERT_EQUAL(2, nclocks);
+
+    fail_hz = 0;
+    TEST_ESP_OK(display_read_region(0, 0, 2, 2, px));
+    display_select(NULL);
+}
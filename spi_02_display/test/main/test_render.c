@@ -0,0 +1,160 @@
+#include "test_display.h"
+#include "display.h"
+#include "display_priv.h"
+#include "display_host.h"
+#include "display_render.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "unity.h"
+
+// The render task: posting order, fill coalescing, done callbacks of
+// dropped images, and several tasks posting at once.
+
+#define PRODUCER_POSTS 500
+
+static uint16_t tile[16 * 16];
+static volatile int done_count;
+static SemaphoreHandle_t gate;
+
+static void count_done(void *arg) {
+    __atomic_add_fetch(&done_count, 1, __ATOMIC_SEQ_CST);
+}
+
+// Posted first, it holds the task so that what follows lands in one batch
+static void wait_at_gate(void *arg) {
+    xSemaphoreTake(gate, portMAX_DELAY);
+}
+
+static void start(void) {
+    test_display_setup();
+    for (int i = 0; i < 16 * 16; i++) tile[i] = DISPLAY_SWAP16(0xABCD);
+    done_count = 0;
+    if (!gate) gate = xSemaphoreCreateBinary();
+    TEST_ESP_OK(display_render_start(32, 5, tskNO_AFFINITY));
+}
+
+// Post strips behind the gate, so they make one batch with it, and count
+// what they put on the bus
+static void post_strips(int strips, display_stats_t *out) {
+    int h = 160 / strips;
+    display_stats_reset();
+    TEST_ESP_OK(display_post_call(wait_at_gate, NULL, portMAX_DELAY));
+    for (int i = 0; i < strips; i++) {
+        TEST_ESP_OK(display_post_fill(0, i * h, 239, i * h + h - 1, 0x07E0, portMAX_DELAY));
+    }
+    xSemaphoreGive(gate);
+    TEST_ESP_OK(display_render_sync(portMAX_DELAY));
+    display_stats_get(out);
+}
+
+TEST_CASE("stacked fills of one color go out as one window", "[render]") {
+    display_stats_t one, stacked;
+
+    start();
+    post_strips(1, &one);
+    TEST_ESP_OK(display_post_fill(0, 0, 239, 319, 0, portMAX_DELAY));
+    TEST_ESP_OK(display_render_sync(portMAX_DELAY));
+    post_strips(8, &stacked);
+    display_render_stop();
+
+    TEST_ASSERT_EQUAL(one.bytes, stacked.bytes);
+    TEST_ASSERT_EQUAL(one.transactions, stacked.transactions);
+    for (int y = 0; y < 160; y++) TEST_ASSERT_EQUAL_HEX16(0x07E0, display_host_pixel(5, y));
+    TEST_ASSERT_EQUAL_HEX16(0, display_host_pixel(5, 160));
+}
+
+TEST_CASE("a covered image is dropped but reports done", "[render]") {
+    start();
+    TEST_ESP_OK(display_post_call(wait_at_gate, NULL, portMAX_DELAY));
+    TEST_ESP_OK(display_post_image(10, 10, 16, 16, tile, count_done, NULL, portMAX_DELAY));
+    TEST_ESP_OK(display_post_fill(0, 0, 100, 100, 0x07E0, portMAX_DELAY));
+    xSemaphoreGive(gate);
+    TEST_ESP_OK(display_render_sync(portMAX_DELAY));
+    TEST_ASSERT_EQUAL(1, done_count);
+    TEST_ASSERT_EQUAL_HEX16(0x07E0, display_host_pixel(12, 12));
+
+    // Not covered: drawn over the fill, in posting order
+    TEST_ESP_OK(display_post_fill(0, 0, 100, 100, 0x001F, portMAX_DELAY));
+    TEST_ESP_OK(display_post_image(10, 10, 16, 16, tile, count_done, NULL, portMAX_DELAY));
+    TEST_ESP_OK(display_render_sync(portMAX_DELAY));
+    TEST_ASSERT_EQUAL(2, done_count);
+    TEST_ASSERT_EQUAL_HEX16(0xABCD, display_host_pixel(12, 12));
+    TEST_ASSERT_EQUAL_HEX16(0x001F, display_host_pixel(50, 50));
+
+    display_render_stop();
+    TEST_ESP_ERR(ESP_ERR_INVALID_STATE, display_post_fill(0, 0, 1, 1, 0, 0));
+}
+
+TEST_CASE("fills are clipped to the render task's panel", "[render]") {
+    display_t *wide;
+    display_config_t cfg = DISPLAY_CONFIG_DEFAULT();
+    cfg.bus = &display_bus_host;
+    cfg.pin_cs = 17;
+
+    // The task draws on a landscape panel, the poster has a portrait one
+    test_display_setup();
+    TEST_ESP_OK(display_create(&cfg, &wide));
+    display_select(wide);
+    ili9341_init();
+    display_set_rotation(DISPLAY_ROTATION_90);
+    TEST_ESP_OK(display_render_start(32, 5, tskNO_AFFINITY));
+    display_select(NULL);
+
+    TEST_ESP_OK(display_post_fill(0, 0, 319, 9, 0xF800, portMAX_DELAY));
+    TEST_ESP_OK(display_render_sync(portMAX_DELAY));
+    display_render_stop();
+
+    // Logical rows 0-9 of the landscape panel are its last ten columns
+    display_select(wide);
+    for (int y = 0; y < DISPLAY_PANEL_HEIGHT; y++) {
+        TEST_ASSERT_EQUAL_HEX16(0xF800, display_host_pixel(DISPLAY_PANEL_WIDTH - 10, y));
+        TEST_ASSERT_EQUAL_HEX16(0, display_host_pixel(DISPLAY_PANEL_WIDTH - 11, y));
+    }
+    display_select(NULL);
+}
+
+typedef struct {
+    int id;
+    TaskHandle_t parent;
+} producer_t;
+
+static void producer(void *arg) {
+    const producer_t *p = arg;
+    for (int i = 0; i < PRODUCER_POSTS; i++) {
+        int y = p->id * 160 + (i % 10) * 16;
+        display_post_fill(0, y, 239, y + 15, (uint16_t)(p->id * 0x1000 + i), portMAX_DELAY);
+        display_post_image(p->id * 100, y, 16, 16, tile, count_done, NULL, portMAX_DELAY);
+    }
+    xTaskNotifyGive(p->parent);
+    vTaskDelete(NULL);
+}
+
+static void raise_flag(void *arg) {
+    *(volatile int *)arg = 1;
+}
+
+TEST_CASE("posts from several tasks all arrive in order", "[render]") {
+    producer_t p[2];
+    volatile int flag = 0;
+
+    start();
+    for (int i = 0; i < 2; i++) {
+        p[i] = (producer_t){i, xTaskGetCurrentTaskHandle()};
+        TEST_ASSERT_EQUAL(pdPASS, xTaskCreate(producer, "producer", 4096, &p[i], 5, NULL));
+    }
+    for (int i = 0; i < 2; i++) ulTaskNotifyTake(pdFALSE, portMAX_DELAY);
+    TEST_ESP_OK(display_post_call(raise_flag, (void *)&flag, portMAX_DELAY));
+    TEST_ESP_OK(display_render_sync(portMAX_DELAY));
+    display_render_stop();
+
+    TEST_ASSERT_EQUAL(2 * PRODUCER_POSTS, done_count);
+    TEST_ASSERT_TRUE(flag);
+    // Each producer's last strip: its fill, then its image on top
+    int last = PRODUCER_POSTS - 1;
+    for (int id = 0; id < 2; id++) {
+        int y = id * 160 + (last % 10) * 16;
+        TEST_ASSERT_EQUAL_HEX16(id * 0x1000 + last, display_host_pixel(200, y));
+        TEST_ASSERT_EQUAL_HEX16(0xABCD, display_host_pixel(id * 100, y));
+    }
+}
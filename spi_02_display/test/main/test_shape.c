@@ -0,0 +1,159 @@
+#include "test_display.h"
+#include "display.h"
+#include "display_priv.h"
+#include "display_host.h"
+#include "display_shape.h"
+#include "display_band.h"
+#include "unity.h"
+#include <stdio.h>
+#include <string.h>
+
+// The span rasterizer: exact coverage of the simple cases, and the same
+// pixels whether a shape is drawn straight to the panel, rasterized into a
+// buffer or drawn as part of a band list.
+
+static uint16_t buf[DISPLAY_PANEL_WIDTH * DISPLAY_PANEL_HEIGHT];
+
+static bool lit(int x, int y) {
+    return buf[y * DISPLAY_PANEL_WIDTH + x] != 0;
+}
+
+static void render(const display_shape_t *s) {
+    memset(buf, 0, sizeof(buf));
+    display_shape_render(s, buf, 0, 0, DISPLAY_PANEL_WIDTH, DISPLAY_PANEL_HEIGHT);
+}
+
+static void check_panel_is_buf(void) {
+    display_wait_done();
+    for (int y = 0; y < DISPLAY_PANEL_HEIGHT; y++) {
+        for (int x = 0; x < DISPLAY_PANEL_WIDTH; x++) {
+            uint16_t want = DISPLAY_SWAP16(buf[y * DISPLAY_PANEL_WIDTH + x]);
+            if (display_host_pixel(x, y) != want) {
+                char msg[64];
+                snprintf(msg, sizeof(msg), "panel and buffer differ at (%d, %d)", x, y);
+                TEST_FAIL_MESSAGE(msg);
+            }
+        }
+    }
+}
+
+TEST_CASE("filled circle covers the midpoint disc", "[shape]") {
+    const int cx = 120, cy = 160, r = 37;
+    display_shape_t c = display_shape_circle(cx, cy, r, 0xFFFF, true);
+    render(&c);
+
+    for (int y = 0; y < DISPLAY_PANEL_HEIGHT; y++) {
+        for (int x = 0; x < DISPLAY_PANEL_WIDTH; x++) {
+            int dx = x - cx, dy = y - cy;
+            TEST_ASSERT_EQUAL(dx * dx + dy * dy <= r * r + r, lit(x, y));
+        }
+    }
+}
+
+TEST_CASE("circle outline is a thin symmetric ring", "[shape]") {
+    const int cx = 120, cy = 160, r = 37;
+    display_shape_t c = display_shape_circle(cx, cy, r, 0xFFFF, false);
+    render(&c);
+
+    for (int y = 0; y < DISPLAY_PANEL_HEIGHT; y++) {
+        for (int x = 0; x < DISPLAY_PANEL_WIDTH; x++) {
+            if (!lit(x, y)) continue;
+            int dx = x - cx, dy = y - cy;
+            TEST_ASSERT_LESS_OR_EQUAL(r * r + r, dx * dx + dy * dy);
+            TEST_ASSERT_GREATER_THAN((r - 2) * (r - 2), dx * dx + dy * dy);
+            TEST_ASSERT_TRUE(lit(cx + dx, cy - dy));
+            TEST_ASSERT_TRUE(lit(cx + dy, cy + dx));
+        }
+    }
+    TEST_ASSERT_TRUE(lit(cx - r, cy));
+    TEST_ASSERT_TRUE(lit(cx, cy - r));
+    TEST_ASSERT_FALSE(lit(cx, cy));
+}
+
+TEST_CASE("square-cornered box and line cover exactly their pixels", "[shape]") {
+    display_shape_t box = display_shape_round_rect(10, 20, 50, 25, 0, 0xFFFF, true);
+    render(&box);
+    for (int y = 0; y < DISPLAY_PANEL_HEIGHT; y++) {
+        for (int x = 0; x < DISPLAY_PANEL_WIDTH; x++) {
+            TEST_ASSERT_EQUAL(x >= 10 && x <= 50 && y >= 20 && y <= 25, lit(x, y));
+        }
+    }
+
+    // An x-major line has one pixel per column, end points included
+    display_shape_t line = display_shape_line(200, 5, 3, 90, 0xFFFF);
+    render(&line);
+    int n = 0;
+    for (int i = 0; i < DISPLAY_PANEL_WIDTH * DISPLAY_PANEL_HEIGHT; i++) {
+        if (buf[i]) n++;
+    }
+    TEST_ASSERT_EQUAL(198, n);
+    TEST_ASSERT_TRUE(lit(200, 5));
+    TEST_ASSERT_TRUE(lit(3, 90));
+    for (int y = 5; y <= 90; y++) {
+        int row = 0;
+        for (int x = 0; x < DISPLAY_PANEL_WIDTH; x++) row += lit(x, y);
+        TEST_ASSERT_GREATER_THAN(0, row);
+    }
+}
+
+TEST_CASE("shapes drawn to the panel match the rasterizer", "[shape]") {
+    display_point_t pts[12];
+    uint32_t seed = 21;
+    test_display_setup();
+    memset(buf, 0, sizeof(buf));
+
+    // Partly off screen on every side
+    for (int i = 0; i < 200; i++) {
+        int type = test_rand(&seed) % 4;
+        uint16_t color = test_rand(&seed) | 1;
+        int x0 = test_rand(&seed) % 400 - 80, y0 = test_rand(&seed) % 480 - 80;
+        int x1 = test_rand(&seed) % 400 - 80, y1 = test_rand(&seed) % 480 - 80;
+        display_shape_t s;
+
+        if (type == 0) {
+            s = display_shape_line(x0, y0, x1, y1, color);
+        } else if (type == 1) {
+            for (int k = 0; k < 12; k++) {
+                pts[k].x = test_rand(&seed) % 300 - 30;
+                pts[k].y = test_rand(&seed) % 380 - 30;
+            }
+            s = display_shape_polyline(pts, 12, test_rand(&seed) & 1, color);
+        } else if (type == 2) {
+            s = display_shape_circle(x0, y0, test_rand(&seed) % 90, color, test_rand(&seed) & 1);
+        } else {
+            s = display_shape_round_rect(x0, y0, x1, y1, test_rand(&seed) % 40, color, test_rand(&seed) & 1);
+        }
+        display_shape_render(&s, buf, 0, 0, DISPLAY_PANEL_WIDTH, DISPLAY_PANEL_HEIGHT);
+        draw_shape(&s);
+        // Polylines are the most intricate: catch a difference right away
+        if (type == 1) check_panel_is_buf();
+    }
+    check_panel_is_buf();
+}
+
+TEST_CASE("shapes in a band list match the rasterizer", "[shape]") {
+    static display_prim_t storage[8];
+    static display_point_t chart[31];
+    display_list_t list;
+    test_display_setup();
+
+    for (int k = 0; k < 31; k++) {
+        chart[k].x = k * 8;
+        chart[k].y = 160 + (k * 37) % 90 - 45;
+    }
+    const display_shape_t shapes[] = {
+        display_shape_polyline(chart, 31, false, 0x07E0),
+        display_shape_circle(60, 60, 50, 0xF800, true),
+        display_shape_round_rect(100, 200, 230, 300, 12, 0x001F, false),
+        display_shape_line(-20, 330, 250, -10, 0xFFFF),
+    };
+
+    memset(buf, 0, sizeof(buf));
+    display_list_init(&list, storage, 8, 0x0000);
+    for (int k = 0; k < 4; k++) {
+        TEST_ASSERT_NOT_NULL(display_list_add_shape(&list, &shapes[k]));
+        display_shape_render(&shapes[k], buf, 0, 0, DISPLAY_PANEL_WIDTH, DISPLAY_PANEL_HEIGHT);
+    }
+    TEST_ESP_OK(display_list_render(&list));
+    check_panel_is_buf();
+}
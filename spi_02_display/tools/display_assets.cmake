@@ -0,0 +1,45 @@
+# Build-time image asset pipeline.
+#
+# display_add_image_assets(<dir>) converts every PNG/BMP in <dir> into a
+# panel-ready blob with tools/img2rgb565.py and embeds it in the component,
+# so "assets/splash.png" becomes the symbols _binary_splash_img_start/_end
+# (see DISPLAY_IMAGE_DECLARE() in display_image.h).
+#
+# A codec can be picked per file through its name: "menu.rle.png" is stored
+# RLE-compressed and "photo.lz4.png" LZ4-compressed; both embed as "menu"
+# and "photo".
+#
+# JPEG files are embedded unchanged for draw_jpeg(): "photo.jpg" becomes
+# _binary_photo_jpg_start/_end (see DISPLAY_JPEG_DECLARE() in display_jpeg.h).
+
+set(DISPLAY_ASSET_TOOL "${CMAKE_CURRENT_LIST_DIR}/img2rgb565.py")
+
+function(display_add_image_assets dir)
+    idf_build_get_property(python PYTHON)
+    file(GLOB sources "${dir}/*.png" "${dir}/*.bmp")
+
+    foreach(src ${sources})
+        get_filename_component(file ${src} NAME)
+        get_filename_component(name ${src} NAME_WE)
+        set(codec raw)
+        if(file MATCHES "\\.(rle|lz4)\\.[^.]+$")
+            set(codec ${CMAKE_MATCH_1})
+        endif()
+        set(blob "${CMAKE_CURRENT_BINARY_DIR}/${name}.img")
+
+        add_custom_command(OUTPUT ${blob}
+            COMMAND ${python} ${DISPLAY_ASSET_TOOL} --codec ${codec} ${src} ${blob}
+            DEPENDS ${src} ${DISPLAY_ASSET_TOOL}
+            COMMENT "Converting image asset ${name} (${codec})"
+            VERBATIM)
+        add_custom_target(display_asset_${name} DEPENDS ${blob})
+        target_add_binary_data(${COMPONENT_LIB} ${blob} BINARY DEPENDS display_asset_${name})
+    endforeach()
+
+    if(NOT IDF_TARGET STREQUAL "linux")
+        file(GLOB jpegs "${dir}/*.jpg")
+        foreach(src ${jpegs})
+            target_add_binary_data(${COMPONENT_LIB} ${src} BINARY)
+        endforeach()
+    endif()
+endfunction()
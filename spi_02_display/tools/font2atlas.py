@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+"""Rasterize a TrueType font into an anti-aliased glyph atlas for the display.
+
+Each glyph is cropped to its ink box and stored as 4-bit coverage, two
+pixels per byte (high nibble first), rows padded to whole bytes. The output
+is a C source file defining one display_font_t (see display_font.h).
+
+Usage: font2atlas.py --size 16 --name dejavu_mono_16 DejaVuSansMono.ttf out.c
+
+Requires Pillow (pip install pillow).
+"""
+
+import argparse
+import os
+import sys
+
+try:
+    from PIL import ImageFont
+except ImportError:
+    sys.exit('font2atlas.py: Pillow is required (pip install pillow)')
+
+
+def rasterize(font, ch):
+    """Ink box offset, size, advance and 4-bit coverage rows of one glyph."""
+    x0, y0, _, _ = font.getbbox(ch, anchor='la')
+    advance = int(round(font.getlength(ch)))
+
+    mask = font.getmask(ch, mode='L')
+    ink = mask.getbbox()
+    if ink is None:
+        return 0, 0, 0, 0, advance, []
+
+    # Crop to the inked pixels; the mask includes blank side bearings
+    bx0, by0, bx1, by1 = ink
+    rows = []
+    for y in range(by0, by1):
+        rows.append([(mask.getpixel((x, y)) * 15 + 127) // 255 for x in range(bx0, bx1)])
+    return x0 + bx0, y0 + by0, bx1 - bx0, by1 - by0, advance, rows
+
+
+def pack4(rows):
+    out = bytearray()
+    for row in rows:
+        if len(row) % 2:
+            row = row + [0]
+        for i in range(0, len(row), 2):
+            out.append((row[i] << 4) | row[i + 1])
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('font', help='TrueType/OpenType file')
+    parser.add_argument('output', help='C source to write')
+    parser.add_argument('--size', type=int, required=True, help='pixel size')
+    parser.add_argument('--name', required=True, help='C identifier suffix')
+    parser.add_argument('--first', type=int, default=0x20, help='first code point')
+    parser.add_argument('--last', type=int, default=0x7E, help='last code point')
+    args = parser.parse_args()
+
+    font = ImageFont.truetype(args.font, args.size)
+    ascent, descent = font.getmetrics()
+
+    bitmap = bytearray()
+    glyphs = []
+    for code in range(args.first, args.last + 1):
+        x0, y0, w, h, advance, rows = rasterize(font, chr(code))
+        glyphs.append((len(bitmap), w, h, x0, y0, advance, code))
+        bitmap += pack4(rows)
+
+    if len(bitmap) > 0xFFFF:
+        sys.exit('font2atlas.py: atlas exceeds 64 KB, use fewer glyphs or a smaller size')
+
+    ident = 'display_font_' + args.name
+    with open(args.output, 'w') as f:
+        f.write('// Generated by tools/font2atlas.py from %s at %d px. Do not edit.\n'
+                % (os.path.basename(args.font), args.size))
+        f.write('#include "display_font.h"\n\n')
+
+        f.write('static const uint8_t bitmap[%d] = {\n' % len(bitmap))
+        for i in range(0, len(bitmap), 16):
+            f.write('    ' + ', '.join('0x%02x' % b for b in bitmap[i:i + 16]) + ',\n')
+        f.write('};\n\n')
+
+        f.write('static const display_glyph_t glyphs[%d] = {\n' % len(glyphs))
+        for offset, w, h, x0, y0, advance, code in glyphs:
+            c = chr(code)
+            comment = {' ': 'space', '\\': 'backslash'}.get(c, c)
+            f.write('    {%5d, %2d, %2d, %3d, %3d, %2d},  // %s\n'
+                    % (offset, w, h, x0, y0, advance, comment))
+        f.write('};\n\n')
+
+        f.write('const display_font_t %s = {\n' % ident)
+        f.write('    .bitmap = bitmap,\n')
+        f.write('    .glyphs = glyphs,\n')
+        f.write('    .first = 0x%02x,\n' % args.first)
+        f.write('    .count = %d,\n' % len(glyphs))
+        f.write('    .line_height = %d,\n' % (ascent + descent))
+        f.write('    .baseline = %d,\n' % ascent)
+        f.write('};\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,180 @@
+#!/usr/bin/env python3
+"""Convert a PNG/BMP image into a display image blob.
+
+The blob starts with an 8-byte little-endian header
+
+    char     magic[2]   "IM"
+    uint8_t  format     0 = RGB565, 1 = RLE, 2 = LZ4
+    uint8_t  flags      reserved, 0
+    uint16_t width
+    uint16_t height
+
+followed by the pixels in the byte order the ILI9341 expects (RGB565, high
+byte first), so the firmware can DMA them straight from flash. The header
+keeps the pixel data 4-byte aligned.
+
+With --codec rle or lz4 the pixels are compressed in independent bands of
+--block-rows rows (see display_image.h for the layout), so the firmware can
+decode one band into a DMA buffer while the previous one is on the wire.
+
+Usage: img2rgb565.py [--codec raw|rle|lz4] [--block-rows N] input.png output.img
+
+Requires Pillow (pip install pillow).
+"""
+
+import argparse
+import struct
+import sys
+
+try:
+    from PIL import Image
+except ImportError:
+    sys.exit('img2rgb565.py: Pillow is required (pip install pillow)')
+
+MAGIC = b'IM'
+FORMAT_RGB565 = 0
+FORMAT_RLE = 1
+FORMAT_LZ4 = 2
+
+LZ4_MIN_MATCH = 4
+LZ4_LAST_LITERALS = 5       # the block must end with at least 5 literals
+LZ4_MFLIMIT = 12            # no match may start in the last 12 bytes
+LZ4_MAX_OFFSET = 65535
+
+
+def to_rgb565_be(image):
+    """Pixels of an RGB image as big-endian RGB565 bytes, row-major."""
+    raw = image.tobytes()
+    out = bytearray()
+    for i in range(0, len(raw), 3):
+        r, g, b = raw[i], raw[i + 1], raw[i + 2]
+        v = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+        out += struct.pack('>H', v)
+    return bytes(out)
+
+
+def header(fmt, width, height):
+    return MAGIC + struct.pack('<BBHH', fmt, 0, width, height)
+
+
+def rle_encode(data):
+    """PackBits-style RLE over 16-bit pixels."""
+    pixels = [data[i:i + 2] for i in range(0, len(data), 2)]
+    out = bytearray()
+    i = 0
+    while i < len(pixels):
+        run = 1
+        while i + run < len(pixels) and run < 128 and pixels[i + run] == pixels[i]:
+            run += 1
+        if run >= 2:
+            out.append(0x80 | (run - 1))
+            out += pixels[i]
+            i += run
+            continue
+
+        # Literals up to the next run of two or more
+        start = i
+        while i < len(pixels) and i - start < 128:
+            if i + 1 < len(pixels) and pixels[i + 1] == pixels[i]:
+                break
+            i += 1
+        if i == start:
+            i += 1
+        out.append(i - start - 1)
+        for p in pixels[start:i]:
+            out += p
+    return bytes(out)
+
+
+def lz4_length(n):
+    """Extra length bytes once a 4-bit token field saturates at 15."""
+    out = bytearray()
+    n -= 15
+    while n >= 255:
+        out.append(255)
+        n -= 255
+    out.append(n)
+    return out
+
+
+def lz4_encode(data):
+    """Greedy LZ4 block compressor (raw block, no frame)."""
+    out = bytearray()
+    table = {}
+    anchor = 0
+    i = 0
+    limit = len(data) - LZ4_MFLIMIT
+
+    while i < limit:
+        key = data[i:i + LZ4_MIN_MATCH]
+        ref = table.get(key)
+        table[key] = i
+        if ref is None or i - ref > LZ4_MAX_OFFSET:
+            i += 1
+            continue
+
+        length = LZ4_MIN_MATCH
+        max_len = len(data) - LZ4_LAST_LITERALS - i
+        while length < max_len and data[ref + length] == data[i + length]:
+            length += 1
+
+        lit = i - anchor
+        ml = length - LZ4_MIN_MATCH
+        out.append((min(lit, 15) << 4) | min(ml, 15))
+        if lit >= 15:
+            out += lz4_length(lit)
+        out += data[anchor:i]
+        out += struct.pack('<H', i - ref)
+        if ml >= 15:
+            out += lz4_length(ml)
+
+        i += length
+        anchor = i
+
+    lit = len(data) - anchor
+    out.append(min(lit, 15) << 4)
+    if lit >= 15:
+        out += lz4_length(lit)
+    out += data[anchor:]
+    return bytes(out)
+
+
+def compress_bands(pixels, width, height, block_rows, encode):
+    row_bytes = width * 2
+    out = bytearray(struct.pack('<HH', block_rows, 0))
+    for y in range(0, height, block_rows):
+        band = pixels[y * row_bytes:min(y + block_rows, height) * row_bytes]
+        packed = encode(band)
+        out += struct.pack('<I', len(packed))
+        out += packed
+    return bytes(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('input', help='PNG or BMP source image')
+    parser.add_argument('output', help='blob to write')
+    parser.add_argument('--codec', choices=('raw', 'rle', 'lz4'), default='raw',
+                        help='pixel compression (default: raw)')
+    parser.add_argument('--block-rows', type=int, default=16,
+                        help='rows per independently decodable band (default: 16)')
+    args = parser.parse_args()
+
+    image = Image.open(args.input).convert('RGB')
+    width, height = image.size
+    pixels = to_rgb565_be(image)
+
+    with open(args.output, 'wb') as f:
+        if args.codec == 'raw':
+            f.write(header(FORMAT_RGB565, width, height))
+            f.write(pixels)
+        elif args.codec == 'rle':
+            f.write(header(FORMAT_RLE, width, height))
+            f.write(compress_bands(pixels, width, height, args.block_rows, rle_encode))
+        else:
+            f.write(header(FORMAT_LZ4, width, height))
+            f.write(compress_bands(pixels, width, height, args.block_rows, lz4_encode))
+
+
+if __name__ == '__main__':
+    main()